@@ -0,0 +1,304 @@
+﻿#include "Linux/TimecodeLinuxSocket.h"
+
+#if PLATFORM_LINUX
+
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformTime.h"
+#include "IPAddress.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+DEFINE_LOG_CATEGORY_STATIC(LogTimecodeLinuxSocket, Log, All);
+
+namespace
+{
+    // Same wait as the FUdpSocketReceiver path so Stop() is honoured promptly
+    constexpr int32 PollTimeoutMs = 100;
+
+    // Timestamps older than this are not trusted (clock step or stalled thread)
+    constexpr double MaxPacketAge = 1.0;
+
+    void ToSockAddr(const FInternetAddr& Addr, sockaddr_in& OutAddr)
+    {
+        uint32 Ip = 0;
+        Addr.GetIp(Ip);
+
+        OutAddr = {};
+        OutAddr.sin_family = AF_INET;
+        OutAddr.sin_addr.s_addr = htonl(Ip);
+        OutAddr.sin_port = htons(static_cast<uint16>(Addr.GetPort()));
+    }
+
+    // Arrival time of a received datagram on the FPlatformTime::Seconds() timebase
+    double GetArrivalTime(msghdr& Message, double ReadTime, const timespec& ReadRealTime)
+    {
+        for (cmsghdr* Header = CMSG_FIRSTHDR(&Message); Header != nullptr; Header = CMSG_NXTHDR(&Message, Header))
+        {
+            if (Header->cmsg_level == SOL_SOCKET && Header->cmsg_type == SCM_TIMESTAMPNS)
+            {
+                timespec KernelTime;
+                FMemory::Memcpy(&KernelTime, CMSG_DATA(Header), sizeof(KernelTime));
+
+                // Map onto the FPlatformTime timebase through the packet age
+                const double Age = static_cast<double>(ReadRealTime.tv_sec - KernelTime.tv_sec) +
+                    static_cast<double>(ReadRealTime.tv_nsec - KernelTime.tv_nsec) * 1e-9;
+                if (Age >= 0.0 && Age < MaxPacketAge)
+                {
+                    return ReadTime - Age;
+                }
+            }
+        }
+        return ReadTime;
+    }
+}
+
+FTimecodeLinuxSocket::FTimecodeLinuxSocket(int32 InBatchCount)
+    : SocketFd(-1)
+    , BatchCount(FMath::Clamp(InBatchCount, 1, MaxBatchCount))
+    , bKernelTimestamps(false)
+    , bStopping(false)
+    , Thread(nullptr)
+{
+    ReceiveBuffer.SetNumUninitialized(BatchCount * SlotSize);
+}
+
+FTimecodeLinuxSocket::~FTimecodeLinuxSocket()
+{
+    Shutdown();
+}
+
+bool FTimecodeLinuxSocket::Open(int32 Port, int32 MaxPortAttempts, int32& OutBoundPort)
+{
+    for (int32 Attempt = 0; Attempt < MaxPortAttempts; ++Attempt)
+    {
+        const int32 CurrentPort = Port == 0 ? 0 : Port + Attempt;
+
+        SocketFd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+        if (SocketFd < 0)
+        {
+            UE_LOG(LogTimecodeLinuxSocket, Error, TEXT("Failed to create socket (errno %d)"), errno);
+            return false;
+        }
+
+        const int Enable = 1;
+        setsockopt(SocketFd, SOL_SOCKET, SO_REUSEADDR, &Enable, sizeof(Enable));
+        setsockopt(SocketFd, SOL_SOCKET, SO_BROADCAST, &Enable, sizeof(Enable));
+
+        sockaddr_in LocalAddr = {};
+        LocalAddr.sin_family = AF_INET;
+        LocalAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+        LocalAddr.sin_port = htons(static_cast<uint16>(CurrentPort));
+
+        if (bind(SocketFd, reinterpret_cast<sockaddr*>(&LocalAddr), sizeof(LocalAddr)) == 0)
+        {
+            bKernelTimestamps = setsockopt(SocketFd, SOL_SOCKET, SO_TIMESTAMPNS, &Enable, sizeof(Enable)) == 0;
+            if (!bKernelTimestamps)
+            {
+                UE_LOG(LogTimecodeLinuxSocket, Warning, TEXT("SO_TIMESTAMPNS not available (errno %d), using read time"), errno);
+            }
+
+            socklen_t AddrLen = sizeof(LocalAddr);
+            getsockname(SocketFd, reinterpret_cast<sockaddr*>(&LocalAddr), &AddrLen);
+            OutBoundPort = ntohs(LocalAddr.sin_port);
+
+            UE_LOG(LogTimecodeLinuxSocket, Log, TEXT("Native socket bound to port %d (batch %d, kernel timestamps %s)"),
+                OutBoundPort, BatchCount, bKernelTimestamps ? TEXT("on") : TEXT("off"));
+            return true;
+        }
+
+        UE_LOG(LogTimecodeLinuxSocket, Warning, TEXT("Failed to bind native socket to port %d, trying alternative port"), CurrentPort);
+        close(SocketFd);
+        SocketFd = -1;
+    }
+
+    return false;
+}
+
+bool FTimecodeLinuxSocket::JoinMulticastGroup(const FString& GroupAddress)
+{
+    if (SocketFd < 0)
+    {
+        return false;
+    }
+
+    ip_mreq Request = {};
+    if (inet_pton(AF_INET, TCHAR_TO_ANSI(*GroupAddress), &Request.imr_multiaddr) != 1)
+    {
+        return false;
+    }
+    Request.imr_interface.s_addr = htonl(INADDR_ANY);
+
+    return setsockopt(SocketFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &Request, sizeof(Request)) == 0;
+}
+
+bool FTimecodeLinuxSocket::StartThread()
+{
+    if (SocketFd < 0 || Thread != nullptr)
+    {
+        return false;
+    }
+
+    bStopping = false;
+    Thread = FRunnableThread::Create(this, TEXT("TimecodeNativeSocket"), 0, TPri_AboveNormal);
+    return Thread != nullptr;
+}
+
+void FTimecodeLinuxSocket::Shutdown()
+{
+    if (Thread != nullptr)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (SocketFd >= 0)
+    {
+        close(SocketFd);
+        SocketFd = -1;
+    }
+}
+
+int32 FTimecodeLinuxSocket::SendTo(const uint8* Data, int32 Num, const FInternetAddr& Destination)
+{
+    if (SocketFd < 0)
+    {
+        return -1;
+    }
+
+    sockaddr_in Addr;
+    ToSockAddr(Destination, Addr);
+    return static_cast<int32>(sendto(SocketFd, Data, Num, 0, reinterpret_cast<sockaddr*>(&Addr), sizeof(Addr)));
+}
+
+int32 FTimecodeLinuxSocket::SendToMany(const uint8* Data, int32 Num, TArrayView<const FInternetAddr* const> Destinations)
+{
+    if (SocketFd < 0 || Destinations.Num() == 0)
+    {
+        return 0;
+    }
+
+    // All messages share one iovec; only the destination differs
+    iovec Vector = { const_cast<uint8*>(Data), static_cast<size_t>(Num) };
+    sockaddr_in Addrs[MaxBatchCount];
+    mmsghdr Messages[MaxBatchCount];
+
+    int32 Sent = 0;
+    while (Sent < Destinations.Num())
+    {
+        const int32 Count = FMath::Min(Destinations.Num() - Sent, MaxBatchCount);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            ToSockAddr(*Destinations[Sent + Index], Addrs[Index]);
+
+            Messages[Index] = {};
+            Messages[Index].msg_hdr.msg_name = &Addrs[Index];
+            Messages[Index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            Messages[Index].msg_hdr.msg_iov = &Vector;
+            Messages[Index].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int Result = sendmmsg(SocketFd, Messages, Count, 0);
+        if (Result <= 0)
+        {
+            UE_LOG(LogTimecodeLinuxSocket, Verbose, TEXT("sendmmsg stopped after %d datagrams (errno %d)"), Sent, errno);
+            break;
+        }
+
+        Sent += Result;
+    }
+
+    return Sent;
+}
+
+int32 FTimecodeLinuxSocket::ReceiveBatch(int32 TimeoutMs)
+{
+    if (SocketFd < 0)
+    {
+        return 0;
+    }
+
+    if (TimeoutMs > 0)
+    {
+        pollfd PollFd = {};
+        PollFd.fd = SocketFd;
+        PollFd.events = POLLIN;
+        if (poll(&PollFd, 1, TimeoutMs) <= 0)
+        {
+            return 0;
+        }
+    }
+
+    iovec Vectors[MaxBatchCount];
+    sockaddr_in Sources[MaxBatchCount];
+    mmsghdr Messages[MaxBatchCount];
+    alignas(cmsghdr) uint8 Control[MaxBatchCount][CMSG_SPACE(sizeof(timespec))];
+
+    for (int32 Index = 0; Index < BatchCount; ++Index)
+    {
+        Vectors[Index] = { ReceiveBuffer.GetData() + Index * SlotSize, static_cast<size_t>(SlotSize) };
+
+        Messages[Index] = {};
+        Messages[Index].msg_hdr.msg_name = &Sources[Index];
+        Messages[Index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        Messages[Index].msg_hdr.msg_iov = &Vectors[Index];
+        Messages[Index].msg_hdr.msg_iovlen = 1;
+        Messages[Index].msg_hdr.msg_control = Control[Index];
+        Messages[Index].msg_hdr.msg_controllen = sizeof(Control[Index]);
+    }
+
+    const int Received = recvmmsg(SocketFd, Messages, BatchCount, MSG_DONTWAIT, nullptr);
+    if (Received <= 0)
+    {
+        return 0; // EAGAIN - queue drained
+    }
+
+    // One clock pair for the whole batch; each datagram keeps its own kernel timestamp
+    const double ReadTime = FPlatformTime::Seconds();
+    timespec ReadRealTime;
+    clock_gettime(CLOCK_REALTIME, &ReadRealTime);
+
+    for (int32 Index = 0; Index < Received; ++Index)
+    {
+        msghdr& Header = Messages[Index].msg_hdr;
+        if (Header.msg_flags & MSG_TRUNC)
+        {
+            UE_LOG(LogTimecodeLinuxSocket, Verbose, TEXT("Dropped truncated datagram"));
+            continue;
+        }
+
+        const FIPv4Endpoint Source(FIPv4Address(ntohl(Sources[Index].sin_addr.s_addr)), ntohs(Sources[Index].sin_port));
+        DatagramReceived.ExecuteIfBound(ReceiveBuffer.GetData() + Index * SlotSize, static_cast<int32>(Messages[Index].msg_len),
+            GetArrivalTime(Header, ReadTime, ReadRealTime), Source);
+    }
+
+    return Received;
+}
+
+void FTimecodeLinuxSocket::Stop()
+{
+    bStopping = true;
+}
+
+uint32 FTimecodeLinuxSocket::Run()
+{
+    while (!bStopping)
+    {
+        // Wait for the first datagram, then keep reading full batches until the queue is empty
+        int32 Received = ReceiveBatch(PollTimeoutMs);
+        while (Received == BatchCount && !bStopping)
+        {
+            Received = ReceiveBatch(0);
+        }
+    }
+
+    return 0;
+}
+
+#endif // PLATFORM_LINUX
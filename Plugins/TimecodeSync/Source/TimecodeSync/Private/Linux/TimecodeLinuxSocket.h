@@ -0,0 +1,98 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_LINUX
+
+#include "HAL/Runnable.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include <atomic>
+
+class FRunnableThread;
+class FInternetAddr;
+
+// Datagram callback (receive thread): data, size, arrival time on the FPlatformTime::Seconds() timebase and sender
+DECLARE_DELEGATE_FourParams(FOnTimecodeDatagramReceived, const uint8* /*Data*/, int32 /*Num*/, double /*ArrivalTime*/, const FIPv4Endpoint& /*Source*/);
+
+/**
+ * Native UDP socket backend for Linux
+ *
+ * Receives with recvmmsg and sends fan-out with sendmmsg, so up to MaxBatchCount datagrams
+ * move per syscall instead of one RecvFrom/SendTo each. SO_TIMESTAMPNS is enabled and the
+ * SCM_TIMESTAMPNS time of every datagram (CLOCK_REALTIME) is mapped onto FPlatformTime::Seconds()
+ * through the age of the packet when it is read, so the arrival time does not include
+ * scheduler wakeup latency. Datagrams without a usable timestamp are stamped when they are read.
+ */
+class FTimecodeLinuxSocket : public FRunnable
+{
+public:
+    // Upper bound for datagrams per recvmmsg/sendmmsg call
+    static constexpr int32 MaxBatchCount = 64;
+
+    // Receive slot size; longer datagrams are truncated by the kernel and dropped
+    static constexpr int32 SlotSize = 2048;
+
+    explicit FTimecodeLinuxSocket(int32 InBatchCount = 32);
+    virtual ~FTimecodeLinuxSocket();
+
+    /**
+     * Create and bind the socket (tries consecutive ports like the FSocket path)
+     * @param Port - First port to try (0 for an ephemeral port)
+     * @param MaxPortAttempts - Number of consecutive ports to try
+     * @param OutBoundPort - Port that was bound
+     * @return true if the socket is bound
+     */
+    bool Open(int32 Port, int32 MaxPortAttempts, int32& OutBoundPort);
+
+    // Join a multicast group on the socket
+    bool JoinMulticastGroup(const FString& GroupAddress);
+
+    // Start the receive thread
+    bool StartThread();
+
+    // Stop the receive thread and close the socket
+    void Shutdown();
+
+    /**
+     * Send one datagram (IPv4 destination)
+     * @return Bytes sent, or -1 on error
+     */
+    int32 SendTo(const uint8* Data, int32 Num, const FInternetAddr& Destination);
+
+    /**
+     * Send the same datagram to several destinations, MaxBatchCount per sendmmsg call
+     * @return Number of destinations the datagram was handed to
+     */
+    int32 SendToMany(const uint8* Data, int32 Num, TArrayView<const FInternetAddr* const> Destinations);
+
+    /**
+     * Read up to the batch count of queued datagrams with one recvmmsg call and dispatch them
+     * @param TimeoutMs - Time to wait for the first datagram (0 = do not wait)
+     * @return Number of datagrams dispatched
+     */
+    int32 ReceiveBatch(int32 TimeoutMs);
+
+    // Whether the kernel accepted SO_TIMESTAMPNS
+    bool HasKernelTimestamps() const { return bKernelTimestamps; }
+
+    int32 GetBatchCount() const { return BatchCount; }
+
+    FOnTimecodeDatagramReceived& OnDatagramReceived() { return DatagramReceived; }
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    int32 SocketFd;
+    int32 BatchCount;
+    bool bKernelTimestamps;
+    std::atomic<bool> bStopping;
+    FRunnableThread* Thread;
+    FOnTimecodeDatagramReceived DatagramReceived;
+
+    // BatchCount receive slots of SlotSize bytes (allocated once)
+    TArray<uint8> ReceiveBuffer;
+};
+
+#endif // PLATFORM_LINUX
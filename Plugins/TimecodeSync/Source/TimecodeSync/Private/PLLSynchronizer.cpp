@@ -11,6 +11,7 @@ UPLLSynchronizer::UPLLSynchronizer()
     Bandwidth = 0.1f;
     DampingFactor = 1.0f;
     FrequencyAdjustmentLimit = 0.2f;
+    HoldoverThreshold = 1.0f;
 
     // Initialize PLL state variables
     CurrentError = 0.0f;
@@ -20,6 +21,8 @@ UPLLSynchronizer::UPLLSynchronizer()
     PhaseAdjustment = 0.0f;
     PhaseOffset = 0.0;
     bIsLocked = false;
+    bHasSample = false;
+    TimeSinceLastSample = 0.0f;
 
     // Default PLL gains
     Alpha = 0.2f;
@@ -73,18 +76,28 @@ float UPLLSynchronizer::ProcessTime(float LocalTime, float MasterTime, float Del
     // Store error for next iteration
     LastError = CurrentError;
 
+    if (IsInHoldover())
+    {
+        UE_LOG(LogPLLSynchronizer, Log, TEXT("PLL holdover ended after %.2fs"), TimeSinceLastSample);
+    }
+    bHasSample = true;
+    TimeSinceLastSample = 0.0f;
+
     return AdjustedTime;
 }
 
 void UPLLSynchronizer::Update(float DeltaTime)
 {
-    // Apply frequency adjustment to time progression
-    // This is called even when no master updates are received
-    // to maintain smooth time adjustment
-    if (FMath::Abs(FrequencyAdjustment - 1.0f) > SMALL_NUMBER)
+    // Called every frame, also when no master updates are received.
+    // The learned frequency adjustment is held rather than decayed toward 1.0,
+    // so the clock keeps compensating the measured drift during holdover.
+    const bool bWasInHoldover = IsInHoldover();
+    TimeSinceLastSample += DeltaTime;
+
+    if (!bWasInHoldover && IsInHoldover())
     {
-        // Gradually move frequency adjustment toward 1.0 when no recent updates
-        FrequencyAdjustment = FMath::FInterpTo(FrequencyAdjustment, 1.0f, DeltaTime, 0.1f);
+        bIsLocked = false;
+        UE_LOG(LogPLLSynchronizer, Log, TEXT("PLL entered holdover, holding frequency adjustment %.6f"), FrequencyAdjustment);
     }
 }
 
@@ -98,6 +111,8 @@ void UPLLSynchronizer::Reset()
     PhaseAdjustment = 0.0f;
     PhaseOffset = 0.0;
     bIsLocked = false;
+    bHasSample = false;
+    TimeSinceLastSample = 0.0f;
 
     UE_LOG(LogPLLSynchronizer, Log, TEXT("PLL Synchronizer reset"));
 }
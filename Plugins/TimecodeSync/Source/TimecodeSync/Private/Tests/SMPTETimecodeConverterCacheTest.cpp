@@ -0,0 +1,68 @@
+﻿// SMPTETimecodeConverterCacheTest.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "SMPTETimecodeConverter.h"
+
+// Per-instance, frame-indexed label cache of USMPTETimecodeConverter
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSMPTETimecodeConverterCacheTest, "TimecodeSync.Utils.SMPTEConverterCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSMPTETimecodeConverterCacheTest::RunTest(const FString& Parameters)
+{
+    // 1. Times inside one frame hit, the next frame misses
+    {
+        USMPTETimecodeConverter* Converter = NewObject<USMPTETimecodeConverter>();
+        TestEqual(TEXT("First frame"), Converter->SecondsToTimecode(1.0f, 30.0f, false), TEXT("00:00:01:00"));
+        TestEqual(TEXT("Same frame"), Converter->SecondsToTimecode(1.02f, 30.0f, false), TEXT("00:00:01:00"));
+        TestEqual(TEXT("Next frame"), Converter->SecondsToTimecode(1.04f, 30.0f, false), TEXT("00:00:01:01"));
+        TestEqual(TEXT("Hits"), Converter->GetCacheHits(), 1LL);
+        TestEqual(TEXT("Misses"), Converter->GetCacheMisses(), 2LL);
+
+        // The same frame at another rate is a different label
+        TestEqual(TEXT("Rate change"), Converter->SecondsToTimecode(1.04f, 25.0f, false), TEXT("00:00:01:01"));
+        TestEqual(TEXT("Rate change misses"), Converter->GetCacheMisses(), 3LL);
+
+        Converter->ResetCacheStats();
+        TestEqual(TEXT("Reset hits"), Converter->GetCacheHits(), 0LL);
+        TestEqual(TEXT("Reset misses"), Converter->GetCacheMisses(), 0LL);
+    }
+
+    // 2. Two converters at different rates do not evict each other
+    {
+        USMPTETimecodeConverter* Film = NewObject<USMPTETimecodeConverter>();
+        USMPTETimecodeConverter* Video = NewObject<USMPTETimecodeConverter>();
+        for (int32 Tick = 0; Tick < 10; ++Tick)
+        {
+            Film->SecondsToTimecode(2.0f, 24.0f, false);
+            Video->SecondsToTimecode(2.0f, 29.97f, true);
+        }
+        TestEqual(TEXT("24fps converter misses once"), Film->GetCacheMisses(), 1LL);
+        TestEqual(TEXT("29.97 DF converter misses once"), Video->GetCacheMisses(), 1LL);
+    }
+
+    // 3. Concurrent conversion from worker threads returns the label of each frame
+    {
+        USMPTETimecodeConverter* Converter = NewObject<USMPTETimecodeConverter>();
+        constexpr int32 Calls = 4000;
+        TArray<FString> Labels;
+        Labels.SetNum(Calls);
+        ParallelFor(Calls, [Converter, &Labels](int32 Index)
+            {
+                Labels[Index] = Converter->SecondsToTimecode((Index % 90 + 0.5f) / 30.0f, 30.0f, false);
+            });
+
+        int32 Mismatches = 0;
+        for (int32 Index = 0; Index < Calls; ++Index)
+        {
+            const int32 Frame = Index % 90;
+            if (Labels[Index] != FString::Printf(TEXT("00:00:%02d:%02d"), Frame / 30, Frame % 30))
+            {
+                ++Mismatches;
+            }
+        }
+        TestEqual(TEXT("Labels from worker threads"), Mismatches, 0);
+        TestEqual(TEXT("Every call counted"), Converter->GetCacheHits() + Converter->GetCacheMisses(), static_cast<int64>(Calls));
+    }
+
+    return true;
+}
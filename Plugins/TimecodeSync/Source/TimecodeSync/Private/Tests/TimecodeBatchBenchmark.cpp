@@ -0,0 +1,130 @@
+﻿// TimecodeBatchBenchmark.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "TimecodeBatch.h"
+#include "TimecodeUtils.h"
+
+namespace TimecodeBatchBenchmark
+{
+    constexpr int32 EventCount = 20000;     // one large cue sheet
+    constexpr int32 Passes = 20;
+    constexpr double StartSeconds = 10.0 * 3600.0;
+    constexpr double EventSpacing = 1.37;   // irregular spacing so consecutive events rarely share a frame
+
+    double PerSecond(double Elapsed)
+    {
+        return static_cast<double>(EventCount) * Passes / FMath::Max(Elapsed, 1e-9);
+    }
+}
+
+// Conversions per second: UTimecodeUtils string functions, FTimecodeValue per event and the batch API
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeBatchBenchmark, "TimecodeSync.Utils.BatchBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTimecodeBatchBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace TimecodeBatchBenchmark;
+
+    const float FrameRate = 29.97f;
+    const FTimecodeValue RateValue = FTimecodeValue::FromFrameRate(FrameRate, true);
+    const FTimecodeRate Rate = RateValue.GetRate();
+
+    TArray<double> Seconds;
+    TArray<int64> FrameNumbers;
+    TArray<FString> Labels;
+    Seconds.Reserve(EventCount);
+    FrameNumbers.Reserve(EventCount);
+    Labels.Reserve(EventCount);
+    for (int32 Index = 0; Index < EventCount; ++Index)
+    {
+        const double EventSeconds = StartSeconds + Index * EventSpacing;
+        Seconds.Add(EventSeconds);
+        FrameNumbers.Add(FTimecodeValue::FromSeconds(EventSeconds, Rate.Numerator, Rate.Denominator, true).FrameNumber);
+        Labels.Add(UTimecodeUtils::SecondsToTimecode(static_cast<float>(EventSeconds), FrameRate, true));
+    }
+
+    TArray<FTimecodePackedFields> Fields;
+    Fields.SetNum(EventCount);
+    TArray<double> SecondsBack;
+    SecondsBack.SetNum(EventCount);
+    int64 Checksum = 0;
+
+    // 1. Seconds -> label: UTimecodeUtils::SecondsToTimecode per event
+    double Start = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        for (int32 Index = 0; Index < EventCount; ++Index)
+        {
+            Checksum += UTimecodeUtils::SecondsToTimecode(static_cast<float>(Seconds[Index]), FrameRate, true).Len();
+        }
+    }
+    const double StringForward = FPlatformTime::Seconds() - Start;
+
+    // 2. Frame -> fields: FTimecodeValue::ToFields per event
+    Start = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        for (int32 Index = 0; Index < EventCount; ++Index)
+        {
+            Checksum += FTimecodeValue(FrameNumbers[Index], Rate.Numerator, Rate.Denominator, true).ToFields().Frames;
+        }
+    }
+    const double ScalarForward = FPlatformTime::Seconds() - Start;
+
+    // 3. Frame -> fields: batch
+    Start = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        TimecodeBatch::FramesToFields(FrameNumbers, Rate, Fields);
+        Checksum += Fields[Pass].Frames;
+    }
+    const double BatchForward = FPlatformTime::Seconds() - Start;
+
+    // 4. Seconds -> fields: batch
+    Start = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        TimecodeBatch::SecondsToFields(Seconds, Rate, Fields);
+        Checksum += Fields[Pass].Frames;
+    }
+    const double BatchSecondsForward = FPlatformTime::Seconds() - Start;
+
+    // 5. Label -> seconds: UTimecodeUtils::TimecodeToSeconds per event
+    Start = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        for (int32 Index = 0; Index < EventCount; ++Index)
+        {
+            Checksum += static_cast<int64>(UTimecodeUtils::TimecodeToSeconds(Labels[Index], FrameRate, true));
+        }
+    }
+    const double StringReverse = FPlatformTime::Seconds() - Start;
+
+    // 6. Fields -> seconds: batch
+    Start = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        TimecodeBatch::FieldsToSeconds(Fields, Rate, SecondsBack);
+        Checksum += static_cast<int64>(SecondsBack[Pass]);
+    }
+    const double BatchReverse = FPlatformTime::Seconds() - Start;
+
+    // The batch labels are the labels the string functions print
+    TCHAR Buffer[FTimecodeValue::FormattedLength + 1];
+    const FTimecodePackedFields& Last = Fields.Last();
+    FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), TEXT("%02d:%02d:%02d;%02d"), Last.Hours, Last.Minutes, Last.Seconds, Last.Frames);
+    TestEqual(TEXT("Last batch label"), FString(Buffer), FTimecodeValue(FrameNumbers.Last(), Rate.Numerator, Rate.Denominator, true).ToString());
+    TestTrue(TEXT("Checksum"), Checksum != 0);
+
+    AddInfo(FString::Printf(TEXT("%d events at 29.97 DF, %d passes"), EventCount, Passes));
+    AddInfo(FString::Printf(TEXT("UTimecodeUtils::SecondsToTimecode: %.2f M/s"), PerSecond(StringForward) * 1e-6));
+    AddInfo(FString::Printf(TEXT("FTimecodeValue::ToFields per event: %.2f M/s"), PerSecond(ScalarForward) * 1e-6));
+    AddInfo(FString::Printf(TEXT("TimecodeBatch::FramesToFields: %.2f M/s (x%.1f vs SecondsToTimecode, x%.1f vs ToFields)"),
+        PerSecond(BatchForward) * 1e-6, StringForward / FMath::Max(BatchForward, 1e-9), ScalarForward / FMath::Max(BatchForward, 1e-9)));
+    AddInfo(FString::Printf(TEXT("TimecodeBatch::SecondsToFields: %.2f M/s"), PerSecond(BatchSecondsForward) * 1e-6));
+    AddInfo(FString::Printf(TEXT("UTimecodeUtils::TimecodeToSeconds: %.2f M/s"), PerSecond(StringReverse) * 1e-6));
+    AddInfo(FString::Printf(TEXT("TimecodeBatch::FieldsToSeconds: %.2f M/s (x%.1f)"),
+        PerSecond(BatchReverse) * 1e-6, StringReverse / FMath::Max(BatchReverse, 1e-9)));
+
+    return true;
+}
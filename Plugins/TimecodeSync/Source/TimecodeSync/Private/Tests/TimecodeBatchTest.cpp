@@ -0,0 +1,88 @@
+﻿// TimecodeBatchTest.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TimecodeBatch.h"
+
+// Batch conversion matches FTimecodeValue on and around the vector range
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeBatchTest, "TimecodeSync.Utils.TimecodeBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTimecodeBatchTest::RunTest(const FString& Parameters)
+{
+    // Every 7th frame of a day, the edges of the vector range, negatives and an odd tail
+    TArray<int64> FrameNumbers;
+    for (int64 Frame = 0; Frame < 24LL * 3600 * 120; Frame += 7)
+    {
+        FrameNumbers.Add(Frame);
+    }
+    FrameNumbers.Append({ -1, -1000, TimecodeBatch::MaxVectorFrame - 1, TimecodeBatch::MaxVectorFrame, 1LL << 40, 17982, 17983 });
+
+    TArray<FTimecodePackedFields> Fields;
+    Fields.SetNum(FrameNumbers.Num());
+    TArray<int64> RoundTrip;
+    RoundTrip.SetNum(FrameNumbers.Num());
+
+    for (const FTimecodeRate& Rate : FTimecodeValue::StandardRates)
+    {
+        const FString RateName = FString::Printf(TEXT("%d/%d%s"), Rate.Numerator, Rate.Denominator, Rate.IsDropFrame() ? TEXT(" DF") : TEXT(""));
+
+        // 1. Frames -> fields
+        TestEqual(FString::Printf(TEXT("Converted count at %s"), *RateName), TimecodeBatch::FramesToFields(FrameNumbers, Rate, Fields), FrameNumbers.Num());
+
+        int32 Mismatches = 0;
+        for (int32 Index = 0; Index < FrameNumbers.Num(); ++Index)
+        {
+            const FTimecodeFields Expected = FTimecodeValue(FrameNumbers[Index], Rate.Numerator, Rate.Denominator, Rate.IsDropFrame()).ToFields();
+            const FTimecodePackedFields& Actual = Fields[Index];
+            if (Actual.Hours != Expected.Hours % 100 || Actual.Minutes != Expected.Minutes ||
+                Actual.Seconds != Expected.Seconds || Actual.Frames != Expected.Frames)
+            {
+                ++Mismatches;
+            }
+        }
+        TestEqual(FString::Printf(TEXT("Fields match FTimecodeValue at %s"), *RateName), Mismatches, 0);
+
+        // 2. Fields -> frames inside one 100 hour label cycle
+        TimecodeBatch::FieldsToFrames(Fields, Rate, RoundTrip);
+        int32 RoundTripFailures = 0;
+        for (int32 Index = 0; Index < FrameNumbers.Num(); ++Index)
+        {
+            const int64 Frame = FrameNumbers[Index];
+            if (Frame >= 0 && Frame < TimecodeBatch::MaxVectorFrame && RoundTrip[Index] != Frame)
+            {
+                ++RoundTripFailures;
+            }
+        }
+        TestEqual(FString::Printf(TEXT("Fields round trip at %s"), *RateName), RoundTripFailures, 0);
+    }
+
+    // 3. Seconds use the same frame rounding as FTimecodeValue::FromSeconds
+    {
+        const FTimecodeRate Rate = FTimecodeValue::FromFrameRate(29.97f, true).GetRate();
+        const TArray<double> Seconds = { 0.0, -1.0, 60.0, 60.06, 600.0, 3600.0, 36000.5, 86399.99 };
+        TArray<FTimecodePackedFields> SecondFields;
+        SecondFields.SetNum(Seconds.Num());
+        TimecodeBatch::SecondsToFields(Seconds, Rate, SecondFields);
+
+        TArray<double> SecondsBack;
+        SecondsBack.SetNum(Seconds.Num());
+        TimecodeBatch::FieldsToSeconds(SecondFields, Rate, SecondsBack);
+
+        for (int32 Index = 0; Index < Seconds.Num(); ++Index)
+        {
+            const FTimecodeValue Expected = FTimecodeValue::FromSeconds(Seconds[Index], 30000, 1001, true);
+            const FTimecodeFields ExpectedFields = Expected.ToFields();
+            TestEqual(FString::Printf(TEXT("Frames of %.2f s"), Seconds[Index]), static_cast<int32>(SecondFields[Index].Frames), ExpectedFields.Frames);
+            TestEqual(FString::Printf(TEXT("Seconds of %.2f s"), Seconds[Index]), static_cast<int32>(SecondFields[Index].Seconds), ExpectedFields.Seconds);
+            TestEqual(FString::Printf(TEXT("Frame start of %.2f s"), Seconds[Index]), SecondsBack[Index], Expected.ToSeconds());
+        }
+    }
+
+    // 4. Shorter output arrays bound the conversion
+    {
+        FTimecodePackedFields Two[2];
+        TestEqual(TEXT("Output length bounds the count"),
+            TimecodeBatch::FramesToFields(FrameNumbers, FTimecodeValue::StandardRates[0], MakeArrayView(Two, 2)), 2);
+    }
+
+    return true;
+}
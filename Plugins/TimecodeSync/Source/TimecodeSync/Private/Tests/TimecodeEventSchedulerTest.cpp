@@ -0,0 +1,204 @@
+﻿// TimecodeEventSchedulerTest.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformProcess.h"
+#include "TimecodeEventScheduler.h"
+
+// Fire info (scheduled timecode, lateness) and dispatch from the scheduler thread
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeEventSchedulerTest, "TimecodeSync.Utils.EventScheduler", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTimecodeEventSchedulerTest::RunTest(const FString& Parameters)
+{
+    // 1. Direct dispatch against a stopped clock: lateness is measured from the scheduled time
+    {
+        FTimecodeEventScheduler Scheduler;
+        FTimecodeMasterClock Clock;
+        Clock.SetSeconds(5.0);
+        Scheduler.SetClock(Clock);
+        Scheduler.SetFrameRate(30.0f, false);
+
+        Scheduler.AddEvent(TEXT("A"), 1.0);
+        Scheduler.AddEvent(TEXT("B"), 5.0);
+        Scheduler.AddEvent(TEXT("C"), 6.0);
+
+        TArray<FTimecodeEventFireInfo> Fired;
+        Scheduler.OnEventDispatched().AddLambda([&Fired](const FTimecodeEventFireInfo& Info)
+            {
+                Fired.Add(Info);
+            });
+
+        TestEqual(TEXT("Two events due"), Scheduler.DispatchDue(), 2);
+        TestEqual(TEXT("Nothing due twice"), Scheduler.DispatchDue(), 0);
+        if (TestEqual(TEXT("Two callbacks"), Fired.Num(), 2))
+        {
+            TestEqual(TEXT("First event"), Fired[0].EventName, FString(TEXT("A")));
+            TestEqual(TEXT("Scheduled timecode"), Fired[0].ScheduledTimecode, FString(TEXT("00:00:01:00")));
+            TestEqual(TEXT("Late by 4s"), Fired[0].LatenessSeconds, 4.0);
+            TestEqual(TEXT("On time"), Fired[1].LatenessSeconds, 0.0);
+            TestTrue(TEXT("Marked as worker dispatch"), Fired[1].bFromWorkerThread);
+        }
+
+        Scheduler.Seek(0.0);
+        Fired.Reset();
+        TestEqual(TEXT("Seek makes events pending again"), Scheduler.DispatchDue(), 2);
+    }
+
+    // 2. Loop range: the scheduler wraps its own cursor and never fires events at or past the loop end
+    {
+        FTimecodeEventScheduler Scheduler;
+        Scheduler.SetLoopRange(1.0, 2.0);
+        Scheduler.AddEvent(TEXT("Start"), 1.0);
+        Scheduler.AddEvent(TEXT("In"), 1.5);
+        Scheduler.AddEvent(TEXT("End"), 2.0);
+        Scheduler.AddEvent(TEXT("After"), 2.5);
+
+        TArray<FTimecodeEventFireInfo> Fired;
+        Scheduler.OnEventDispatched().AddLambda([&Fired](const FTimecodeEventFireInfo& Info)
+            {
+                Fired.Add(Info);
+            });
+
+        const auto FiredNames = [&Fired]()
+        {
+            TArray<FString> Names;
+            for (const FTimecodeEventFireInfo& Info : Fired)
+            {
+                Names.Add(Info.EventName);
+            }
+            return FString::Join(Names, TEXT(","));
+        };
+
+        FTimecodeMasterClock Clock;
+        Clock.SetSeconds(1.6);
+        Scheduler.SetClock(Clock);
+        Scheduler.Seek(1.2);
+        TestEqual(TEXT("Inside the loop"), Scheduler.DispatchDue(), 1);
+
+        // Owner clock past the end before it wrapped: the scheduler wraps first
+        Clock.SetSeconds(2.7);
+        Scheduler.SetClock(Clock);
+        Scheduler.DispatchDue();
+        TestEqual(TEXT("Wrapped to the start, nothing past the end"), FiredNames(), FString(TEXT("In,Start,In")));
+
+        // The owner's own wrap maps onto the same pass
+        Clock.SetSeconds(1.7);
+        Scheduler.SetClock(Clock);
+        TestEqual(TEXT("Owner wrap does not fire the pass again"), Scheduler.DispatchDue(), 0);
+
+        // Owner wraps before the scheduler saw the end
+        Clock.SetSeconds(1.9);
+        Scheduler.SetClock(Clock);
+        Scheduler.DispatchDue();
+        Clock.SetSeconds(2.4);
+        Scheduler.SetClock(Clock);
+        Clock.SetSeconds(1.4);
+        Scheduler.SetClock(Clock);
+        Fired.Reset();
+        Scheduler.DispatchDue();
+        TestEqual(TEXT("Late owner wrap still wraps the cursor"), FiredNames(), FString(TEXT("Start")));
+
+        Scheduler.ClearLoopRange();
+        Clock.SetSeconds(2.6);
+        Scheduler.SetClock(Clock);
+        Fired.Reset();
+        Scheduler.DispatchDue();
+        TestEqual(TEXT("Without a loop the events past the end fire"), FiredNames(), FString(TEXT("In,End,After")));
+    }
+
+    // 3. The scheduler thread fires each event near its time without any tick
+    {
+        FTimecodeEventScheduler Scheduler;
+        FCriticalSection FiredLock;
+        TArray<FTimecodeEventFireInfo> Fired;
+        Scheduler.OnEventDispatched().AddLambda([&FiredLock, &Fired](const FTimecodeEventFireInfo& Info)
+            {
+                FScopeLock ScopeLock(&FiredLock);
+                Fired.Add(Info);
+            });
+
+        constexpr int32 EventCount = 5;
+        for (int32 Index = 0; Index < EventCount; ++Index)
+        {
+            Scheduler.AddEvent(FString::Printf(TEXT("Cue%d"), Index), 0.02 * (Index + 1));
+        }
+
+        FTimecodeMasterClock Clock;
+        Clock.Start();
+        Scheduler.SetClock(Clock);
+        if (!TestTrue(TEXT("Thread started"), Scheduler.StartThread()))
+        {
+            return false;
+        }
+
+        const double Deadline = FPlatformTime::Seconds() + 2.0;
+        int32 Count = 0;
+        while (Count < EventCount && FPlatformTime::Seconds() < Deadline)
+        {
+            FPlatformProcess::Sleep(0.005f);
+            FScopeLock ScopeLock(&FiredLock);
+            Count = Fired.Num();
+        }
+        Scheduler.Shutdown();
+
+        if (TestEqual(TEXT("Every event fired"), Fired.Num(), EventCount))
+        {
+            double MaxLateness = 0.0;
+            for (int32 Index = 0; Index < EventCount; ++Index)
+            {
+                TestEqual(TEXT("In order"), Fired[Index].EventName, FString::Printf(TEXT("Cue%d"), Index));
+                TestTrue(TEXT("Not early"), Fired[Index].LatenessSeconds >= 0.0);
+                MaxLateness = FMath::Max(MaxLateness, Fired[Index].LatenessSeconds);
+            }
+
+            // Wall-clock timing depends on the machine, so it is reported rather than asserted
+            AddInfo(FString::Printf(TEXT("Scheduler thread max lateness: %.3f ms"), MaxLateness * 1000.0));
+        }
+    }
+
+    // 4. The scheduler thread wraps a forward loop on its own, even with no cue past the loop end
+    {
+        FTimecodeEventScheduler Scheduler;
+        FCriticalSection FiredLock;
+        TArray<FTimecodeEventFireInfo> Fired;
+        Scheduler.OnEventDispatched().AddLambda([&FiredLock, &Fired](const FTimecodeEventFireInfo& Info)
+            {
+                FScopeLock ScopeLock(&FiredLock);
+                Fired.Add(Info);
+            });
+
+        Scheduler.SetLoopRange(0.0, 0.05);
+        Scheduler.AddEvent(TEXT("First"), 0.01);
+        Scheduler.AddEvent(TEXT("Second"), 0.03);
+
+        FTimecodeMasterClock Clock;
+        Clock.Start();
+        Scheduler.SetClock(Clock);
+        if (!TestTrue(TEXT("Loop thread started"), Scheduler.StartThread()))
+        {
+            return false;
+        }
+
+        // Three passes; the owner never seeks the scheduler on its own forward wrap
+        constexpr int32 ExpectedCount = 6;
+        const double Deadline = FPlatformTime::Seconds() + 2.0;
+        int32 Count = 0;
+        while (Count < ExpectedCount && FPlatformTime::Seconds() < Deadline)
+        {
+            FPlatformProcess::Sleep(0.005f);
+            FScopeLock ScopeLock(&FiredLock);
+            Count = Fired.Num();
+        }
+        Scheduler.Shutdown();
+
+        if (TestTrue(TEXT("Cues fire again on every pass"), Fired.Num() >= ExpectedCount))
+        {
+            for (int32 Index = 0; Index < ExpectedCount; ++Index)
+            {
+                TestEqual(TEXT("Pass order"), Fired[Index].EventName, FString(Index % 2 == 0 ? TEXT("First") : TEXT("Second")));
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,125 @@
+﻿// TimecodeEventTimelineTest.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TimecodeEventTimeline.h"
+
+// Sorted cue list: in-order firing, cursor, seek, late registration and removal
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeEventTimelineTest, "TimecodeSync.Utils.EventTimeline", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTimecodeEventTimelineTest::RunTest(const FString& Parameters)
+{
+    TArray<FString> Fired;
+    auto Record = [&Fired](const FTimecodeTimelineEvent& Event)
+        {
+            Fired.Add(Event.Name);
+        };
+
+    // 1. Events fire once, in time order, with ties in registration order
+    {
+        FTimecodeEventTimeline Timeline;
+        Timeline.Add(TEXT("C"), 3.0);
+        Timeline.Add(TEXT("A"), 1.0);
+        Timeline.Add(TEXT("B1"), 2.0);
+        Timeline.Add(TEXT("B2"), 2.0);
+
+        Fired.Reset();
+        TestEqual(TEXT("Nothing before the first event"), Timeline.Advance(0.5, Record), 0);
+        TestEqual(TEXT("Three events up to 2s"), Timeline.Advance(2.0, Record), 3);
+        TestEqual(TEXT("Already fired events stay fired"), Timeline.Advance(2.5, Record), 0);
+        TestEqual(TEXT("Last event"), Timeline.Advance(10.0, Record), 1);
+        TestEqual(TEXT("Firing order"), FString::Join(Fired, TEXT(",")), FString(TEXT("A,B1,B2,C")));
+        TestEqual(TEXT("Triggered count"), Timeline.GetTriggeredCount(), 4);
+
+        // Going back in time does not fire again; a seek does
+        TestEqual(TEXT("No refire when time goes back"), Timeline.Advance(1.0, Record), 0);
+        Timeline.Seek(2.0);
+        Fired.Reset();
+        TestEqual(TEXT("Seek to 2s leaves three pending"), Timeline.Advance(10.0, Record), 3);
+        TestEqual(TEXT("Events after the seek point"), FString::Join(Fired, TEXT(",")), FString(TEXT("B1,B2,C")));
+
+        Timeline.ResetTriggers();
+        TestEqual(TEXT("Reset makes every event pending"), Timeline.Advance(10.0, Record), 4);
+    }
+
+    // 2. An event registered behind the cursor fires on the next advance; re-registering moves it
+    {
+        FTimecodeEventTimeline Timeline;
+        Timeline.Add(TEXT("A"), 1.0);
+        Timeline.Add(TEXT("B"), 5.0);
+        Timeline.Advance(6.0, Record);
+
+        Fired.Reset();
+        Timeline.Add(TEXT("Late"), 2.0);
+        TestEqual(TEXT("Late event is pending"), Timeline.GetTriggeredCount(), 2);
+        TestEqual(TEXT("Late event fires"), Timeline.Advance(6.0, Record), 1);
+        TestEqual(TEXT("Late event name"), Fired.Num() == 1 ? Fired[0] : FString(), FString(TEXT("Late")));
+
+        TestTrue(TEXT("Re-register replaces"), Timeline.Add(TEXT("A"), 8.0));
+        TestEqual(TEXT("Still two plus late"), Timeline.Num(), 3);
+        double NextTime = 0.0;
+        TestTrue(TEXT("Next event exists"), Timeline.GetNextEventTime(NextTime));
+        TestEqual(TEXT("Next event is the moved one"), NextTime, 8.0);
+
+        TestTrue(TEXT("Remove by name"), Timeline.Remove(TEXT("B")));
+        TestFalse(TEXT("Remove unknown"), Timeline.Remove(TEXT("B")));
+        TestEqual(TEXT("Cursor follows removal"), Timeline.GetTriggeredCount(), 1);
+    }
+
+    // 3. A callback may remove the next event
+    {
+        FTimecodeEventTimeline Timeline;
+        Timeline.Add(TEXT("A"), 1.0);
+        Timeline.Add(TEXT("B"), 2.0);
+        Timeline.Add(TEXT("C"), 3.0);
+
+        Fired.Reset();
+        Timeline.Advance(10.0, [&Fired, &Timeline](const FTimecodeTimelineEvent& Event)
+            {
+                Fired.Add(Event.Name);
+                if (Event.Name == TEXT("A"))
+                {
+                    Timeline.Remove(TEXT("B"));
+                }
+            });
+        TestEqual(TEXT("Removed event is skipped"), FString::Join(Fired, TEXT(",")), FString(TEXT("A,C")));
+    }
+
+    // 4. Rewinding re-arms the events passed, without firing them
+    {
+        FTimecodeEventTimeline Timeline;
+        Timeline.Add(TEXT("A"), 1.0);
+        Timeline.Add(TEXT("B"), 2.0);
+        Timeline.Add(TEXT("C"), 3.0);
+        Timeline.Advance(10.0, Record);
+        Timeline.Add(TEXT("Late"), 2.5);
+
+        Timeline.Rewind(1.5);
+        TestEqual(TEXT("Only A stays triggered"), Timeline.GetTriggeredCount(), 1);
+        Fired.Reset();
+        TestEqual(TEXT("Rewound events fire again going forward"), Timeline.Advance(10.0, Record), 3);
+        TestEqual(TEXT("In time order, late event included once"), FString::Join(Fired, TEXT(",")), FString(TEXT("B,Late,C")));
+    }
+
+    // 5. With 20k cues a quiet tick examines nothing and a seek lands on the right event
+    {
+        FTimecodeEventTimeline Timeline;
+        constexpr int32 CueCount = 20000;
+        for (int32 Index = 0; Index < CueCount; ++Index)
+        {
+            Timeline.Add(FString::Printf(TEXT("Cue%d"), Index), Index * 0.5);
+        }
+
+        int32 Examined = 0;
+        auto Count = [&Examined](const FTimecodeTimelineEvent&)
+            {
+                ++Examined;
+            };
+        Timeline.Seek(5000.0);
+        TestEqual(TEXT("Seek passes the earlier cues"), Timeline.GetTriggeredCount(), 10000);
+        TestEqual(TEXT("Quiet tick"), Timeline.Advance(5000.2, Count), 1);
+        TestEqual(TEXT("One cue per half second"), Timeline.Advance(5010.0, Count), 20);
+        TestEqual(TEXT("Only reached cues were examined"), Examined, 21);
+    }
+
+    return true;
+}
@@ -0,0 +1,75 @@
+﻿// TimecodeFormatBenchmark.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "TimecodeValue.h"
+
+namespace TimecodeFormatBenchmark
+{
+    constexpr int32 TickCount = 1000000;
+    constexpr double TickInterval = 1.0 / 60.0;    // 60 Hz ticks, 30 fps timecode: the frame changes every other tick
+    constexpr double StartSeconds = 9.0 * 3600.0;
+}
+
+// Nanoseconds per tick: FString::Printf + string compare versus FormatTo into a stack buffer
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeFormatBenchmark, "TimecodeSync.Utils.FormatBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTimecodeFormatBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace TimecodeFormatBenchmark;
+
+    // 1. Previous per-tick path: format every tick with Printf and compare against the current string
+    FString PrintfTimecode;
+    int32 PrintfChanges = 0;
+    const double PrintfStart = FPlatformTime::Seconds();
+    for (int32 Tick = 0; Tick < TickCount; ++Tick)
+    {
+        const FTimecodeFields Fields = FTimecodeValue::FromSeconds(StartSeconds + Tick * TickInterval, 30, 1, false).ToFields();
+        FString NewTimecode = FString::Printf(TEXT("%02d:%02d:%02d:%02d"), Fields.Hours, Fields.Minutes, Fields.Seconds, Fields.Frames);
+        if (NewTimecode != PrintfTimecode)
+        {
+            PrintfTimecode = MoveTemp(NewTimecode);
+            ++PrintfChanges;
+        }
+    }
+    const double PrintfElapsed = FPlatformTime::Seconds() - PrintfStart;
+
+    // 2. Formatter path: compare frame numbers, format into a stack buffer and build the string only on change
+    FString BufferTimecode;
+    FTimecodeValue Current(-1, 30, 1, false);
+    int32 BufferChanges = 0;
+    const double BufferStart = FPlatformTime::Seconds();
+    for (int32 Tick = 0; Tick < TickCount; ++Tick)
+    {
+        const FTimecodeValue Value = FTimecodeValue::FromSeconds(StartSeconds + Tick * TickInterval, 30, 1, false);
+        if (Value != Current)
+        {
+            TCHAR Buffer[FTimecodeValue::FormattedLength + 1];
+            BufferTimecode = FString(Value.FormatTo(Buffer), Buffer);
+            Current = Value;
+            ++BufferChanges;
+        }
+    }
+    const double BufferElapsed = FPlatformTime::Seconds() - BufferStart;
+
+    // 3. Formatting alone, every call
+    TCHAR Buffer[FTimecodeValue::FormattedLength + 1];
+    int32 Checksum = 0;
+    const double FormatStart = FPlatformTime::Seconds();
+    for (int32 Tick = 0; Tick < TickCount; ++Tick)
+    {
+        Checksum += FTimecodeValue(Tick, 30, 1, false).FormatTo(Buffer) + Buffer[10];
+    }
+    const double FormatElapsed = FPlatformTime::Seconds() - FormatStart;
+
+    TestEqual(TEXT("Both paths publish the same number of changes"), BufferChanges, PrintfChanges);
+    TestEqual(TEXT("Both paths end on the same timecode"), BufferTimecode, PrintfTimecode);
+    TestTrue(TEXT("Formatter checksum"), Checksum != 0);
+
+    AddInfo(FString::Printf(TEXT("Printf + FString compare: %.1f ns/tick"), PrintfElapsed * 1e9 / TickCount));
+    AddInfo(FString::Printf(TEXT("Frame compare + FormatTo on change: %.1f ns/tick (x%.1f)"),
+        BufferElapsed * 1e9 / TickCount, PrintfElapsed / FMath::Max(BufferElapsed, 1e-9)));
+    AddInfo(FString::Printf(TEXT("FormatTo alone: %.1f ns/call"), FormatElapsed * 1e9 / TickCount));
+
+    return true;
+}
@@ -0,0 +1,72 @@
+﻿// TimecodeMasterClockTest.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "TimecodeMasterClock.h"
+
+// Master clock resolution late in a broadcast day, start/stop behaviour and playback rate
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeMasterClockTest, "TimecodeSync.Utils.MasterClock", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTimecodeMasterClockTest::RunTest(const FString& Parameters)
+{
+    const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+    const uint64 FrameCycles = static_cast<uint64>(1.0 / (30.0 * SecondsPerCycle));
+
+    // 1. One frame step is resolved exactly after 10 hours
+    {
+        FTimecodeMasterClock Clock;
+        Clock.Start();
+        Clock.SetSeconds(36000.0);
+
+        const uint64 Now = FPlatformTime::Cycles64();
+        const double Before = Clock.GetSecondsAt(Now);
+        const double After = Clock.GetSecondsAt(Now + FrameCycles);
+        TestTrue(TEXT("Clock is past 10 hours"), Before >= 36000.0);
+        TestTrue(TEXT("Frame step resolved to 1us at 10 hours"),
+            FMath::Abs((After - Before) - FrameCycles * SecondsPerCycle) < 1e-6);
+
+        // The float accumulator this replaces cannot represent the same step
+        const float Accumulated = 36000.0f + static_cast<float>(FrameCycles * SecondsPerCycle);
+        AddInfo(FString::Printf(TEXT("Float accumulator error at 10 hours: %.3fms per frame"),
+            FMath::Abs((Accumulated - 36000.0f) - FrameCycles * SecondsPerCycle) * 1000.0));
+    }
+
+    // 2. Stop freezes the value, start resumes from it
+    {
+        FTimecodeMasterClock Clock;
+        TestEqual(TEXT("Stopped clock starts at 0"), Clock.GetSeconds(), 0.0);
+
+        Clock.SetSeconds(5.0);
+        TestEqual(TEXT("Set while stopped does not run"), Clock.GetSecondsAt(FPlatformTime::Cycles64() + FrameCycles), 5.0);
+
+        Clock.Start();
+        TestTrue(TEXT("Running clock advances"), Clock.GetSecondsAt(FPlatformTime::Cycles64() + FrameCycles) > 5.0);
+
+        Clock.Stop();
+        const double Frozen = Clock.GetSeconds();
+        TestEqual(TEXT("Stopped clock holds its value"), Clock.GetSecondsAt(FPlatformTime::Cycles64() + 100 * FrameCycles), Frozen);
+        TestTrue(TEXT("Stopped clock kept elapsed time"), Frozen >= 5.0);
+    }
+
+    // 3. Rate scales elapsed time from the moment it is set, including reverse
+    {
+        FTimecodeMasterClock Clock;
+        Clock.SetSeconds(100.0);
+        Clock.SetRate(2.0);
+        TestEqual(TEXT("Rate change keeps the value"), Clock.GetSeconds(), 100.0);
+
+        Clock.Start();
+        const uint64 Now = FPlatformTime::Cycles64();
+        const double Base = Clock.GetSecondsAt(Now);
+        TestTrue(TEXT("Double speed"),
+            FMath::Abs((Clock.GetSecondsAt(Now + 30 * FrameCycles) - Base) - 2.0 * 30 * FrameCycles * SecondsPerCycle) < 1e-6);
+
+        Clock.SetRate(-1.0);
+        const uint64 ReverseStart = FPlatformTime::Cycles64();
+        const double ReverseBase = Clock.GetSecondsAt(ReverseStart);
+        TestTrue(TEXT("Reverse counts down"), Clock.GetSecondsAt(ReverseStart + 30 * FrameCycles) < ReverseBase);
+        TestEqual(TEXT("Rate is kept"), Clock.GetRate(), -1.0);
+    }
+
+    return true;
+}
@@ -0,0 +1,173 @@
+﻿// TimecodeSocketBenchmark.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if PLATFORM_LINUX
+#include "Linux/TimecodeLinuxSocket.h"
+#include "Common/UdpSocketReceiver.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+#include "IPAddress.h"
+#include "HAL/PlatformProcess.h"
+#include <atomic>
+
+namespace TimecodeSocketBenchmark
+{
+    constexpr int32 PacketCount = 20000;
+    constexpr int32 BurstSize = 32;
+    constexpr int32 PacketSize = 64;
+    constexpr double CatchUpTimeout = 1.0;
+
+    // Wait until the receive thread has counted every datagram sent so far
+    bool WaitForReceiver(const std::atomic<int32>& Received, int32 Expected)
+    {
+        const double Deadline = FPlatformTime::Seconds() + CatchUpTimeout;
+        while (Received.load(std::memory_order_relaxed) < Expected)
+        {
+            if (FPlatformTime::Seconds() > Deadline)
+            {
+                return false;
+            }
+            FPlatformProcess::YieldThread();
+        }
+        return true;
+    }
+
+    FSocket* CreateLoopbackSocket(ISocketSubsystem* SocketSubsystem)
+    {
+        FSocket* Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("TimecodeBenchmark"), true);
+        TSharedRef<FInternetAddr> LocalAddr = SocketSubsystem->CreateInternetAddr();
+        LocalAddr->SetLoopbackAddress();
+        LocalAddr->SetPort(0);
+        if (Socket && !Socket->Bind(*LocalAddr))
+        {
+            SocketSubsystem->DestroySocket(Socket);
+            Socket = nullptr;
+        }
+        return Socket;
+    }
+
+    TSharedRef<FInternetAddr> MakeLoopbackAddr(ISocketSubsystem* SocketSubsystem, int32 Port)
+    {
+        TSharedRef<FInternetAddr> Addr = SocketSubsystem->CreateInternetAddr();
+        Addr->SetLoopbackAddress();
+        Addr->SetPort(Port);
+        return Addr;
+    }
+}
+
+// Packets per second: FSocket::SendTo + FUdpSocketReceiver versus the recvmmsg/sendmmsg backend
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeSocketBackendBenchmark, "TimecodeSync.Network.SocketBackendBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FTimecodeSocketBackendBenchmark::RunTest(const FString& Parameters)
+{
+    using namespace TimecodeSocketBenchmark;
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!TestNotNull(TEXT("Socket subsystem"), SocketSubsystem))
+    {
+        return false;
+    }
+
+    uint8 Packet[PacketSize];
+    FMemory::Memset(Packet, 0x5A, PacketSize);
+
+    // 1. Current path: one SendTo per datagram, FUdpSocketReceiver reads one RecvFrom per datagram
+    double CurrentPps = 0.0;
+    {
+        FSocket* RxSocket = CreateLoopbackSocket(SocketSubsystem);
+        FSocket* TxSocket = CreateLoopbackSocket(SocketSubsystem);
+        if (!TestNotNull(TEXT("FSocket receiver"), RxSocket) || !TestNotNull(TEXT("FSocket sender"), TxSocket))
+        {
+            return false;
+        }
+
+        std::atomic<int32> Received(0);
+        FUdpSocketReceiver* Receiver = new FUdpSocketReceiver(RxSocket, FTimespan::FromMilliseconds(100), TEXT("TimecodeBenchmarkRx"));
+        Receiver->OnDataReceived().BindLambda([&Received](const FArrayReaderPtr&, const FIPv4Endpoint&)
+            {
+                Received.fetch_add(1, std::memory_order_relaxed);
+            });
+        Receiver->Start();
+
+        TSharedRef<FInternetAddr> Destination = MakeLoopbackAddr(SocketSubsystem, RxSocket->GetPortNo());
+
+        const double StartTime = FPlatformTime::Seconds();
+        int32 Sent = 0;
+        while (Sent < PacketCount)
+        {
+            for (int32 Index = 0; Index < BurstSize; ++Index, ++Sent)
+            {
+                int32 BytesSent = 0;
+                TxSocket->SendTo(Packet, PacketSize, BytesSent, *Destination);
+            }
+            if (!WaitForReceiver(Received, Sent))
+            {
+                break;
+            }
+        }
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+        CurrentPps = Received.load() / FMath::Max(Elapsed, 1e-9);
+
+        TestEqual(TEXT("FSocket path received every datagram"), Received.load(), Sent);
+
+        Receiver->Stop();
+        delete Receiver;
+        SocketSubsystem->DestroySocket(RxSocket);
+        SocketSubsystem->DestroySocket(TxSocket);
+    }
+
+    // 2. Native backend: sendmmsg fan-out (one destination per slot) and recvmmsg batches
+    double NativePps = 0.0;
+    {
+        FTimecodeLinuxSocket RxSocket(BurstSize);
+        FTimecodeLinuxSocket TxSocket(BurstSize);
+        int32 RxPort = 0;
+        int32 TxPort = 0;
+        if (!TestTrue(TEXT("Native receiver bound"), RxSocket.Open(0, 1, RxPort)) ||
+            !TestTrue(TEXT("Native sender bound"), TxSocket.Open(0, 1, TxPort)))
+        {
+            return false;
+        }
+
+        std::atomic<int32> Received(0);
+        RxSocket.OnDatagramReceived().BindLambda([&Received](const uint8*, int32, double, const FIPv4Endpoint&)
+            {
+                Received.fetch_add(1, std::memory_order_relaxed);
+            });
+        RxSocket.StartThread();
+
+        TSharedRef<FInternetAddr> Destination = MakeLoopbackAddr(SocketSubsystem, RxPort);
+        const FInternetAddr* Destinations[BurstSize];
+        for (int32 Index = 0; Index < BurstSize; ++Index)
+        {
+            Destinations[Index] = &Destination.Get();
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        int32 Sent = 0;
+        while (Sent < PacketCount)
+        {
+            Sent += TxSocket.SendToMany(Packet, PacketSize, MakeArrayView(Destinations, BurstSize));
+            if (!WaitForReceiver(Received, Sent))
+            {
+                break;
+            }
+        }
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+        NativePps = Received.load() / FMath::Max(Elapsed, 1e-9);
+
+        TestEqual(TEXT("Native path received every datagram"), Received.load(), Sent);
+
+        RxSocket.Shutdown();
+        TxSocket.Shutdown();
+    }
+
+    AddInfo(FString::Printf(TEXT("FSocket + FUdpSocketReceiver: %.0f packets/s"), CurrentPps));
+    AddInfo(FString::Printf(TEXT("recvmmsg/sendmmsg (batch %d): %.0f packets/s (x%.2f)"),
+        BurstSize, NativePps, NativePps / FMath::Max(CurrentPps, 1.0)));
+
+    return true;
+}
+
+#endif // PLATFORM_LINUX
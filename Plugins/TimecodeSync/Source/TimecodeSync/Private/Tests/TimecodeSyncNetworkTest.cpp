@@ -1,6 +1,9 @@
 ﻿// TimecodeSyncNetworkTest.cpp (Modified version)
 #include "Tests/TimecodeSyncNetworkTest.h"
 #include "TimecodeNetworkManager.h"
+#include "TimecodePacketInbox.h"
+#include "TimecodeValue.h"
+#include "PLLSynchronizer.h"
 #include "Misc/AutomationTest.h"
 #include "Logging/LogMacros.h"
 #include "Tests/TimecodeSyncTestLogger.h"  // 새 로거 헤더 추가
@@ -205,6 +208,116 @@ bool UTimecodeSyncNetworkTest::TestPacketLoss(float LossPercentage)
     return bSuccess;
 }
 
+bool UTimecodeSyncNetworkTest::TestSequenceTracking()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Sequence Tracking"), TEXT("Sequence Tracking: Testing..."));
+
+    FTimecodeSequenceWindow Window;
+    FTimecodeSenderStats Stats;
+
+    // 1, 2, 5 (3 and 4 missing), 3 (late), 5 (duplicate), 4 (late), 2 (duplicate), 6
+    const bool bOrderOk =
+        Window.Check(1, Stats) == ETimecodeSequenceResult::InOrder &&
+        Window.Check(2, Stats) == ETimecodeSequenceResult::InOrder &&
+        Window.Check(5, Stats) == ETimecodeSequenceResult::InOrder &&
+        Window.Check(3, Stats) == ETimecodeSequenceResult::Reordered &&
+        Window.Check(5, Stats) == ETimecodeSequenceResult::Duplicate &&
+        Window.Check(4, Stats) == ETimecodeSequenceResult::Reordered &&
+        Window.Check(2, Stats) == ETimecodeSequenceResult::Duplicate &&
+        Window.Check(6, Stats) == ETimecodeSequenceResult::InOrder;
+
+    const bool bCountsOk = Stats.ReceivedCount == 4 && Stats.LostCount == 0 &&
+        Stats.ReorderedCount == 2 && Stats.DuplicateCount == 2 && Stats.LastSequence == 6;
+
+    // Gap that is never filled stays counted as loss
+    const bool bGapOk = Window.Check(10, Stats) == ETimecodeSequenceResult::InOrder && Stats.LostCount == 3;
+
+    // Counter wrap-around is still in order (0 is skipped by senders)
+    FTimecodeSequenceWindow WrapWindow;
+    FTimecodeSenderStats WrapStats;
+    const bool bWrapOk =
+        WrapWindow.Check(0xFFFFFFFEu, WrapStats) == ETimecodeSequenceResult::InOrder &&
+        WrapWindow.Check(0xFFFFFFFFu, WrapStats) == ETimecodeSequenceResult::InOrder &&
+        WrapWindow.Check(1, WrapStats) == ETimecodeSequenceResult::InOrder &&
+        WrapStats.LostCount == 0;
+
+    // A jump far ahead is a sender restart, not a burst of lost packets
+    FTimecodeSequenceWindow JumpWindow;
+    FTimecodeSenderStats JumpStats;
+    const bool bJumpOk =
+        JumpWindow.Check(5, JumpStats) == ETimecodeSequenceResult::InOrder &&
+        JumpWindow.Check(0x80000000u, JumpStats) == ETimecodeSequenceResult::InOrder &&
+        JumpWindow.Check(0x80000001u, JumpStats) == ETimecodeSequenceResult::InOrder &&
+        JumpStats.LostCount == 0 && JumpStats.ReceivedCount == 3;
+
+    // Sequence number survives the wire round trip
+    FTimecodeNetworkMessage Original;
+    Original.MessageType = ETimecodeMessageType::TimecodeSync;
+    Original.Sequence = 123456;
+    FTimecodeNetworkMessage Decoded;
+    const bool bWireOk = Decoded.Deserialize(Original.Serialize()) && Decoded.Sequence == Original.Sequence;
+
+    const bool bSuccess = bOrderOk && bCountsOk && bGapOk && bWrapOk && bJumpOk && bWireOk;
+    const FString ResultMessage = FString::Printf(
+        TEXT("Order: %s, Counters: %s (recv %d, lost %d, reordered %d, dup %d), Gap: %s, Wrap: %s, Jump: %s, Wire: %s"),
+        bOrderOk ? TEXT("OK") : TEXT("FAIL"), bCountsOk ? TEXT("OK") : TEXT("FAIL"),
+        Stats.ReceivedCount, Stats.LostCount, Stats.ReorderedCount, Stats.DuplicateCount,
+        bGapOk ? TEXT("OK") : TEXT("FAIL"), bWrapOk ? TEXT("OK") : TEXT("FAIL"),
+        bJumpOk ? TEXT("OK") : TEXT("FAIL"), bWireOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Sequence Tracking"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestPacketInbox()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Packet Inbox"), TEXT("Packet Inbox: Testing..."));
+
+    // Queue 6 one-byte datagrams (0..5) into a 4-slot inbox and drain the survivors
+    auto RunOverflow = [](ETimecodeInboxDropPolicy Policy, TArray<uint8>& OutDrained, FTimecodeInboxStats& OutStats)
+    {
+        FTimecodePacketInbox Inbox;
+        Inbox.Initialize(4, 8);
+        Inbox.SetDropPolicy(Policy);
+
+        for (uint8 Value = 0; Value < 6; ++Value)
+        {
+            Inbox.Enqueue(&Value, 1);
+        }
+
+        const uint8 Oversized[16] = {};
+        Inbox.Enqueue(Oversized, sizeof(Oversized));
+
+        Inbox.Drain([&OutDrained](const uint8* Data, int32 Num, const FIPv4Endpoint&, double)
+            {
+                OutDrained.Add(Data[0]);
+            });
+        OutStats = Inbox.GetStats();
+    };
+
+    TArray<uint8> NewestDrained;
+    FTimecodeInboxStats NewestStats;
+    RunOverflow(ETimecodeInboxDropPolicy::DropNewest, NewestDrained, NewestStats);
+    const bool bDropNewestOk = NewestDrained == TArray<uint8>({ 0, 1, 2, 3 }) &&
+        NewestStats.EnqueuedCount == 4 && NewestStats.DroppedNewestCount == 2 &&
+        NewestStats.DroppedOldestCount == 0 && NewestStats.OversizedCount == 1;
+
+    TArray<uint8> OldestDrained;
+    FTimecodeInboxStats OldestStats;
+    RunOverflow(ETimecodeInboxDropPolicy::DropOldest, OldestDrained, OldestStats);
+    const bool bDropOldestOk = OldestDrained == TArray<uint8>({ 2, 3, 4, 5 }) &&
+        OldestStats.EnqueuedCount == 6 && OldestStats.DroppedNewestCount == 0 &&
+        OldestStats.DroppedOldestCount == 2 && OldestStats.MaxDrainedPerTick == 4;
+
+    const bool bSuccess = bDropNewestOk && bDropOldestOk;
+    const FString ResultMessage = FString::Printf(TEXT("DropNewest: %s (%d drained), DropOldest: %s (%d drained)"),
+        bDropNewestOk ? TEXT("OK") : TEXT("FAIL"), NewestDrained.Num(),
+        bDropOldestOk ? TEXT("OK") : TEXT("FAIL"), OldestDrained.Num());
+
+    LogTestResult(TEXT("Packet Inbox"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
 void UTimecodeSyncNetworkTest::LogTestResult(const FString& TestName, bool bSuccess, const FString& Message)
 {
     // 새 로거 사용
@@ -256,7 +369,7 @@ bool UTimecodeSyncNetworkTest::TestMessageSerialization()
                 bool bMessagesEqual =
                     (DeserializedMessage.MessageType == OriginalMessage.MessageType) &&
                     (DeserializedMessage.Timecode == OriginalMessage.Timecode) &&
-                    (DeserializedMessage.SenderID == OriginalMessage.SenderID);
+                    (DeserializedMessage.SenderNumericID == FTimecodeNetworkMessage::MakeSenderNumericID(OriginalMessage.SenderID));
 
                 if (!bMessagesEqual)
                 {
@@ -317,7 +430,7 @@ bool UTimecodeSyncNetworkTest::TestMessageSerialization()
                     (DeserializedMessage.MessageType == OriginalMessage.MessageType) &&
                     (DeserializedMessage.Timecode == OriginalMessage.Timecode) &&
                     (DeserializedMessage.Data == OriginalMessage.Data) &&
-                    (DeserializedMessage.SenderID == OriginalMessage.SenderID);
+                    (DeserializedMessage.SenderNumericID == FTimecodeNetworkMessage::MakeSenderNumericID(OriginalMessage.SenderID));
 
                 if (!bMessagesEqual)
                 {
@@ -337,7 +450,607 @@ bool UTimecodeSyncNetworkTest::TestMessageSerialization()
         }
     }
 
+    // Test case 3: Legacy string format is still readable
+    {
+        auto AppendLegacyString = [](TArray<uint8>& Buffer, const ANSICHAR* Value)
+        {
+            const uint16 Length = static_cast<uint16>(FCStringAnsi::Strlen(Value));
+            Buffer.Add(Length & 0xFF);
+            Buffer.Add((Length >> 8) & 0xFF);
+            Buffer.Append(reinterpret_cast<const uint8*>(Value), Length);
+            Buffer.Add(0);
+        };
+
+        const double LegacyTimestamp = 1234.5;
+        uint64 TimestampBits;
+        FMemory::Memcpy(&TimestampBits, &LegacyTimestamp, sizeof(double));
+
+        TArray<uint8> LegacyData;
+        LegacyData.Add(static_cast<uint8>(ETimecodeMessageType::Event));
+        AppendLegacyString(LegacyData, "00:10:00;00");
+        AppendLegacyString(LegacyData, "LegacyEvent");
+        for (int32 i = 0; i < sizeof(double); ++i)
+        {
+            LegacyData.Add((TimestampBits >> ((sizeof(double) - 1 - i) * 8)) & 0xFF);
+        }
+        AppendLegacyString(LegacyData, "LegacySender");
+
+        FTimecodeNetworkMessage DeserializedMessage;
+        const bool bLegacyDecoded = DeserializedMessage.Deserialize(LegacyData) &&
+            (DeserializedMessage.MessageType == ETimecodeMessageType::Event) &&
+            (DeserializedMessage.Timecode == TEXT("00:10:00;00")) &&
+            (DeserializedMessage.Data == TEXT("LegacyEvent")) &&
+            (DeserializedMessage.SenderID == TEXT("LegacySender")) &&
+            (DeserializedMessage.Timestamp == LegacyTimestamp);
+
+        if (!bLegacyDecoded)
+        {
+            bSuccess = false;
+            ResultMessage += TEXT("Test Case 3: Legacy format decode failed\n");
+            UTimecodeSyncTestLogger::Get()->LogError(TEXT("Message Serialization"),
+                TEXT("Test Case 3: Legacy format decode failed"));
+        }
+        else
+        {
+            ResultMessage += TEXT("Test Case 3: Successfully decoded legacy string format\n");
+            UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Message Serialization"),
+                TEXT("Test Case 3: Successfully decoded legacy string format"));
+        }
+    }
+
+    // Test case 4: Encode/decode through caller-owned buffers
+    {
+        FTimecodeMessageView OriginalView;
+        OriginalView.MessageType = ETimecodeMessageType::TimecodeSync;
+        OriginalView.SetTimecode(TEXT("10:20:30;15"), 29.97f);
+        OriginalView.SenderID = 0x12345678;
+        OriginalView.Timestamp = 42.125;
+
+        uint8 Buffer[TimecodeWire::HeaderSize];
+        const int32 EncodedSize = OriginalView.Encode(Buffer);
+
+        FTimecodeMessageView DecodedView;
+        const bool bViewDecoded = (EncodedSize == TimecodeWire::HeaderSize) &&
+            FTimecodeMessageView::Decode(MakeArrayView(Buffer, EncodedSize), DecodedView) &&
+            (DecodedView.MessageType == OriginalView.MessageType) &&
+            (DecodedView.FrameNumber == OriginalView.FrameNumber) &&
+            (DecodedView.Rate == ETimecodeWireRate::Fps29_97) &&
+            DecodedView.IsDropFrame() &&
+            (DecodedView.SenderID == OriginalView.SenderID) &&
+            (DecodedView.Timestamp == OriginalView.Timestamp) &&
+            (DecodedView.GetTimecodeString() == TEXT("10:20:30;15"));
+
+        // Buffers that are too small must be rejected rather than overrun
+        uint8 SmallBuffer[TimecodeWire::HeaderSize - 1];
+        const bool bRejectsSmallBuffer = OriginalView.Encode(SmallBuffer) == 0;
+
+        // Label seconds agree with FTimecodeValue at 29.97, drop and non-drop
+        const FTimecodeFields Fields{ 10, 20, 30, 15 };
+        FTimecodeMessageView NonDropView;
+        NonDropView.SetTimecode(TEXT("10:20:30:15"), 29.97f);
+        const bool bSecondsOk =
+            FMath::IsNearlyEqual(DecodedView.GetTimecodeSeconds(), FTimecodeValue::FromFields(Fields, 30000, 1001, true).ToSeconds(), 1e-9) &&
+            FMath::IsNearlyEqual(NonDropView.GetTimecodeSeconds(), FTimecodeValue::FromFields(Fields, 30000, 1001, false).ToSeconds(), 1e-9);
+
+        if (!bViewDecoded || !bRejectsSmallBuffer || !bSecondsOk)
+        {
+            bSuccess = false;
+            ResultMessage += TEXT("Test Case 4: Buffer encode/decode failed\n");
+            UTimecodeSyncTestLogger::Get()->LogError(TEXT("Message Serialization"),
+                TEXT("Test Case 4: Buffer encode/decode failed"));
+        }
+        else
+        {
+            ResultMessage += TEXT("Test Case 4: Successfully encoded and decoded through stack buffers\n");
+            UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Message Serialization"),
+                TEXT("Test Case 4: Successfully encoded and decoded through stack buffers"));
+        }
+    }
+
+    // Test case 5: Several messages packed back to back in one datagram
+    {
+        FTimecodeNetworkMessage EventMessage;
+        EventMessage.MessageType = ETimecodeMessageType::Event;
+        EventMessage.Timecode = TEXT("00:00:05:00");
+        EventMessage.Data = TEXT("CueA");
+        EventMessage.Sequence = 7;
+
+        FTimecodeMessageView SyncView;
+        SyncView.MessageType = ETimecodeMessageType::TimecodeSync;
+        SyncView.SetTimecode(TEXT("00:00:05:00"), 30.0f);
+        SyncView.Sequence = 8;
+
+        uint8 Datagram[TimecodeWire::MaxDatagramSize];
+        int32 DatagramSize = EventMessage.Serialize(MakeArrayView(Datagram));
+        DatagramSize += SyncView.Encode(MakeArrayView(Datagram + DatagramSize, TimecodeWire::MaxDatagramSize - DatagramSize));
+
+        // Split the datagram again the way the receiver does
+        TArray<FTimecodeMessageView> Split;
+        FTimecodeMessageView View;
+        int32 Offset = 0;
+        while (Offset < DatagramSize &&
+            FTimecodeMessageView::Decode(MakeArrayView(Datagram + Offset, DatagramSize - Offset), View))
+        {
+            Split.Add(View);
+            Offset += View.GetEncodedSize();
+        }
+
+        const bool bBatchOk = Split.Num() == 2 && Offset == DatagramSize &&
+            Split[0].MessageType == ETimecodeMessageType::Event && Split[0].GetPayloadString() == TEXT("CueA") &&
+            Split[0].Sequence == 7 &&
+            Split[1].MessageType == ETimecodeMessageType::TimecodeSync && Split[1].Sequence == 8;
+
+        if (!bBatchOk)
+        {
+            bSuccess = false;
+            ResultMessage += TEXT("Test Case 5: Batched datagram split failed\n");
+            UTimecodeSyncTestLogger::Get()->LogError(TEXT("Message Serialization"),
+                TEXT("Test Case 5: Batched datagram split failed"));
+        }
+        else
+        {
+            ResultMessage += TEXT("Test Case 5: Successfully split batched datagram\n");
+            UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Message Serialization"),
+                TEXT("Test Case 5: Successfully split batched datagram"));
+        }
+    }
+
     // Log overall result
     LogTestResult(TEXT("Message Serialization"), bSuccess, ResultMessage);
     return bSuccess;
-}
\ No newline at end of file
+}
+
+bool UTimecodeSyncNetworkTest::TestDelayMeasurement()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Delay Measurement"), TEXT("Delay Measurement: Testing..."));
+
+    // Master clock runs 5 s ahead, 2 ms each way, 0.5 ms master residence time
+    const double T1 = 100.0;
+    const double T2 = 105.002;
+    const double T3 = 105.0025;
+    const double T4 = 100.0045;
+
+    // Response survives the wire round trip
+    FTimecodeDelayResponse Response;
+    Response.RequesterID = 0x1234ABCD;
+    Response.RequestTime = T1;
+    Response.ReceiveTime = T2;
+
+    uint8 Payload[FTimecodeDelayResponse::PayloadSize];
+    FTimecodeMessageView Reply;
+    Reply.MessageType = ETimecodeMessageType::DelayResponse;
+    Reply.SenderID = 42;
+    Reply.Timestamp = T3;
+    Reply.Payload = Payload;
+    Reply.PayloadLength = static_cast<uint16>(Response.Encode(Payload));
+
+    uint8 Buffer[TimecodeWire::HeaderSize + FTimecodeDelayResponse::PayloadSize];
+    const int32 Size = Reply.Encode(Buffer);
+
+    FTimecodeMessageView DecodedView;
+    FTimecodeDelayResponse Decoded;
+    const bool bWireOk = Size == sizeof(Buffer) &&
+        FTimecodeMessageView::Decode(MakeArrayView(Buffer, Size), DecodedView) &&
+        Decoded.Decode(DecodedView) &&
+        Decoded.RequesterID == Response.RequesterID &&
+        Decoded.RequestTime == T1 && Decoded.ReceiveTime == T2 && DecodedView.Timestamp == T3;
+
+    // Other message types are not read as a response
+    FTimecodeMessageView Request;
+    Request.MessageType = ETimecodeMessageType::DelayRequest;
+    const bool bTypeOk = !FTimecodeDelayResponse().Decode(Request);
+
+    const double RoundTrip = Decoded.GetRoundTripDelay(T3, T4);
+    const double Offset = Decoded.GetOffset(T3, T4);
+    const bool bMathOk = FMath::IsNearlyEqual(RoundTrip, 0.004, 1e-9) && FMath::IsNearlyEqual(Offset, 5.0, 1e-9);
+
+    const bool bSuccess = bWireOk && bTypeOk && bMathOk;
+    const FString ResultMessage = FString::Printf(TEXT("Wire: %s, Type check: %s, Round trip: %.6f ms, Offset: %.6f s"),
+        bWireOk ? TEXT("OK") : TEXT("FAIL"), bTypeOk ? TEXT("OK") : TEXT("FAIL"), RoundTrip * 1000.0, Offset);
+
+    LogTestResult(TEXT("Delay Measurement"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestClockFilter()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Clock Filter"), TEXT("Clock Filter: Testing..."));
+
+    // True offset 5 s; samples that waited in a queue on one leg have more delay and a biased offset
+    const double Offsets[] = { 5.004, 5.0001, 5.005, 5.002 };
+    const double Delays[] = { 0.010, 0.002, 0.012, 0.006 };
+
+    FTimecodeClockFilter MinFilter;
+    FTimecodeClockFilter WeightedFilter;
+    WeightedFilter.Mode = ETimecodeClockFilterMode::DelayWeighted;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        MinFilter.AddSample(Offsets[Index], Delays[Index], Index);
+        WeightedFilter.AddSample(Offsets[Index], Delays[Index], Index);
+    }
+
+    const FTimecodeClockFilterStats& Stats = MinFilter.GetStats();
+    const bool bMinimumOk = MinFilter.GetOffset() == 5.0001 && MinFilter.GetDelay() == 0.002 &&
+        MinFilter.GetLocalTime() == 1.0;
+
+    // The servo reads the selected offset carried forward at its frequency (100 ppm over 10 s)
+    const bool bCarryOk = FMath::IsNearlyEqual(MinFilter.GetOffsetAt(11.0, 1.0001), 5.0011, 1e-9) &&
+        MinFilter.GetOffsetAt(11.0, 1.0) == 5.0001;
+    const bool bStatsOk = Stats.SampleCount == 4 && Stats.MinDelay == 0.002 && Stats.MaxDelay == 0.012 &&
+        FMath::IsNearlyEqual(Stats.MeanDelay, 0.0075, 1e-12) && Stats.Jitter > 0.0;
+
+    // Weighted estimate stays much closer to the low-delay sample than the plain mean (5.002775)
+    const bool bWeightedOk = FMath::Abs(WeightedFilter.GetOffset() - 5.0001) < 0.001 &&
+        WeightedFilter.GetDelay() > 0.002 && WeightedFilter.GetDelay() < 0.006 &&
+        WeightedFilter.GetLocalTime() > 0.0 && WeightedFilter.GetLocalTime() < 3.0;
+
+    // The best sample ages out once the window has moved past it
+    for (int32 Index = 0; Index < FTimecodeClockFilter::WindowSize; ++Index)
+    {
+        MinFilter.AddSample(5.01, 0.020, 10 + Index);
+    }
+    const bool bAgingOk = MinFilter.GetStats().SampleCount == FTimecodeClockFilter::WindowSize &&
+        MinFilter.GetDelay() == 0.020;
+
+    MinFilter.Reset();
+    const bool bResetOk = !MinFilter.HasEstimate() && MinFilter.GetStats().SampleCount == 0;
+
+    const bool bSuccess = bMinimumOk && bCarryOk && bStatsOk && bWeightedOk && bAgingOk && bResetOk;
+    const FString ResultMessage = FString::Printf(
+        TEXT("Minimum: %s, Carried forward: %s, Stats: %s, Weighted: %s (%.6f s), Aging: %s, Reset: %s"),
+        bMinimumOk ? TEXT("OK") : TEXT("FAIL"), bCarryOk ? TEXT("OK") : TEXT("FAIL"), bStatsOk ? TEXT("OK") : TEXT("FAIL"),
+        bWeightedOk ? TEXT("OK") : TEXT("FAIL"), WeightedFilter.GetOffset(),
+        bAgingOk ? TEXT("OK") : TEXT("FAIL"), bResetOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Clock Filter"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestSlaveRegistry()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Slave Registry"), TEXT("Slave Registry: Testing..."));
+
+    const FIPv4Endpoint SlaveA(FIPv4Address(10, 0, 0, 2), 10001);
+    const FIPv4Endpoint SlaveB(FIPv4Address(10, 0, 0, 3), 10001);
+    const FIPv4Endpoint SlaveBRestarted(FIPv4Address(10, 0, 0, 3), 10002);
+
+    // Source endpoint travels through the inbox to the game thread
+    FTimecodePacketInbox Inbox;
+    Inbox.Initialize(4, TimecodeWire::MaxDatagramSize);
+    const uint8 Datagram[TimecodeWire::HeaderSize] = {};
+    Inbox.Enqueue(Datagram, sizeof(Datagram), SlaveA);
+    FIPv4Endpoint DrainedSource;
+    Inbox.Drain([&DrainedSource](const uint8*, int32, const FIPv4Endpoint& Source, double) { DrainedSource = Source; });
+    const bool bInboxOk = DrainedSource == SlaveA;
+
+    // Join adds a slave once; repeated joins only refresh liveness
+    FTimecodeSlaveRegistry Registry;
+    const bool bFirstJoin = Registry.Register(1, SlaveA, 0.0);
+    const bool bSecondJoin = Registry.Register(2, SlaveB, 0.0);
+    const bool bRefresh = !Registry.Register(1, SlaveA, 4.0);
+    const bool bJoinOk = bFirstJoin && bSecondJoin && bRefresh &&
+        Registry.Num() == 2 && Registry.GetDestinations().Num() == 2;
+
+    // A restarted slave on a new port replaces its entry
+    const bool bMovedOk = Registry.Register(2, SlaveBRestarted, 1.0) && Registry.Num() == 2 &&
+        Registry.GetDestinations().Num() == 2;
+
+    // Slave 2 last joined at 1 s and times out at 6 s; slave 1 refreshed at 4 s stays
+    const int32 Removed = Registry.Prune(7.5, 6.0);
+    const TArray<FTimecodeSlaveInfo> Slaves = Registry.GetSlaveInfo(7.5);
+    const bool bPruneOk = Removed == 1 && Slaves.Num() == 1 && Registry.GetDestinations().Num() == 1 &&
+        Slaves[0].SenderID == TEXT("00000001") && Slaves[0].Address == SlaveA.ToString() &&
+        FMath::IsNearlyEqual(Slaves[0].SecondsSinceLastSeen, 3.5f);
+
+    Registry.Reset();
+    const bool bResetOk = Registry.Num() == 0 && Registry.GetDestinations().Num() == 0;
+
+    const bool bSuccess = bInboxOk && bJoinOk && bMovedOk && bPruneOk && bResetOk;
+    const FString ResultMessage = FString::Printf(TEXT("Inbox source: %s, Join: %s, Endpoint change: %s, Timeout: %s, Reset: %s"),
+        bInboxOk ? TEXT("OK") : TEXT("FAIL"), bJoinOk ? TEXT("OK") : TEXT("FAIL"), bMovedOk ? TEXT("OK") : TEXT("FAIL"),
+        bPruneOk ? TEXT("OK") : TEXT("FAIL"), bResetOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Slave Registry"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestRelayCorrection()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Relay Correction"), TEXT("Relay Correction: Testing..."));
+
+    // Master sync message without a correction field
+    FTimecodeMessageView Sync;
+    Sync.MessageType = ETimecodeMessageType::TimecodeSync;
+    Sync.SetTimecode(TEXT("01:00:00:00"), 30.0f);
+    Sync.SenderID = 0xCAFE0001;
+    Sync.Sequence = 7;
+    Sync.Timestamp = 500.0;
+    const bool bNoneOk = !Sync.HasCorrection() && Sync.GetCorrection() == 0.0;
+
+    // Each relay adds its upstream one-way delay and residence time, keeping sender and sequence
+    const double Hops[2][2] = { { 0.0015, 0.0002 }, { 0.0008, 0.0003 } };
+    uint8 Wire[TimecodeWire::MaxMessageSize];
+    int32 WireSize = Sync.Encode(Wire);
+    bool bHopsOk = WireSize > 0;
+    for (const double* Hop : Hops)
+    {
+        FTimecodeMessageView Received;
+        bHopsOk &= FTimecodeMessageView::Decode(MakeArrayView(Wire, WireSize), Received);
+
+        uint8 CorrectionStorage[TimecodeWire::CorrectionSize];
+        FTimecodeMessageView Forwarded = Received;
+        Forwarded.SetCorrection(Received.GetCorrection() + Hop[0] + Hop[1], CorrectionStorage);
+
+        uint8 Next[TimecodeWire::MaxMessageSize];
+        WireSize = Forwarded.Encode(Next);
+        FMemory::Memcpy(Wire, Next, WireSize);
+    }
+
+    FTimecodeMessageView Leaf;
+    bHopsOk &= FTimecodeMessageView::Decode(MakeArrayView(Wire, WireSize), Leaf);
+    const double Correction = Leaf.GetCorrection();
+    const bool bFieldsOk = bHopsOk && Leaf.HasCorrection() && Leaf.HasTimecode() &&
+        Leaf.SenderID == Sync.SenderID && Leaf.Sequence == Sync.Sequence && Leaf.Timestamp == Sync.Timestamp &&
+        Leaf.GetTimecodeString() == TEXT("01:00:00:00") && Leaf.GetPayloadString().IsEmpty();
+    const bool bSumOk = FMath::IsNearlyEqual(Correction, 0.0028, 1e-12);
+
+    const bool bSuccess = bNoneOk && bFieldsOk && bSumOk;
+    const FString ResultMessage = FString::Printf(TEXT("No correction: %s, Forwarded fields: %s, Accumulated: %.4f ms"),
+        bNoneOk ? TEXT("OK") : TEXT("FAIL"), bFieldsOk ? TEXT("OK") : TEXT("FAIL"), Correction * 1000.0);
+
+    LogTestResult(TEXT("Relay Correction"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestMasterElection()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Master Election"), TEXT("Master Election: Testing..."));
+
+    // Heartbeat payload survives the wire round trip
+    FTimecodeElectionInfo Sent;
+    Sent.Priority = 10;
+    Sent.ClockQuality = 6;
+    Sent.bIsMaster = true;
+    Sent.UptimeSeconds = 3600;
+
+    uint8 Payload[FTimecodeElectionInfo::PayloadSize];
+    FTimecodeMessageView Heartbeat;
+    Heartbeat.MessageType = ETimecodeMessageType::Heartbeat;
+    Heartbeat.Flags = TimecodeWire::FlagElection;
+    Heartbeat.Payload = Payload;
+    Heartbeat.PayloadLength = static_cast<uint16>(Sent.Encode(Payload));
+
+    uint8 Buffer[TimecodeWire::HeaderSize + FTimecodeElectionInfo::PayloadSize];
+    FTimecodeMessageView DecodedView;
+    FTimecodeElectionInfo Received;
+    const bool bWireOk = FTimecodeMessageView::Decode(MakeArrayView(Buffer, Heartbeat.Encode(Buffer)), DecodedView) &&
+        Received.Decode(DecodedView) && Received.Priority == 10 && Received.ClockQuality == 6 &&
+        Received.bIsMaster && Received.UptimeSeconds == 3600 && DecodedView.GetPayloadString().IsEmpty();
+
+    // Ordering: priority, clock quality, current master, uptime (with tolerance), sender ID
+    FTimecodeElectionInfo Base;
+    FTimecodeElectionInfo HighPriority = Base;
+    HighPriority.Priority = 100;
+    FTimecodeElectionInfo Genlocked = Base;
+    Genlocked.ClockQuality = 6;
+    FTimecodeElectionInfo Incumbent = Base;
+    Incumbent.bIsMaster = true;
+    const bool bOrderOk =
+        FTimecodeMasterElection::IsBetter(9, HighPriority, 0.0, 1, Genlocked, 1000.0) &&
+        FTimecodeMasterElection::IsBetter(9, Genlocked, 0.0, 1, Incumbent, 1000.0) &&
+        FTimecodeMasterElection::IsBetter(9, Incumbent, 0.0, 1, Base, 1000.0) &&
+        FTimecodeMasterElection::IsBetter(9, Base, 100.0, 1, Base, 50.0) &&
+        FTimecodeMasterElection::IsBetter(1, Base, 100.0, 9, Base, 102.0) &&
+        !FTimecodeMasterElection::IsBetter(9, Base, 100.0, 1, Base, 102.0);
+
+    // Node 3 hears master 1 and standby 2; master 1 goes silent and standby 2 takes over
+    const double Timeout = 6.0;
+    FTimecodeElectionInfo Master = Base;
+    Master.bIsMaster = true;
+    Master.UptimeSeconds = 500;
+    FTimecodeElectionInfo Standby = Base;
+    Standby.UptimeSeconds = 400;
+    FTimecodeElectionInfo Local = Base;
+    Local.UptimeSeconds = 10;
+
+    FTimecodeMasterElection Election;
+    Election.Observe(1, Master, 0.0);
+    Election.Observe(2, Standby, 0.0);
+    const bool bSteadyOk = Election.Elect(3, Local, 1.0, Timeout) == 1;
+
+    Election.Observe(2, Standby, 6.0);
+    const uint32 AfterFailure = Election.Elect(3, Local, 7.0, Timeout);
+    const bool bFailoverOk = AfterFailure == 2 && Election.NumCandidates() == 1;
+
+    // Alone, the node elects itself
+    const bool bAloneOk = Election.Elect(3, Local, 20.0, Timeout) == 3 && Election.NumCandidates() == 0;
+
+    const bool bSuccess = bWireOk && bOrderOk && bSteadyOk && bFailoverOk && bAloneOk;
+    const FString ResultMessage = FString::Printf(TEXT("Wire: %s, Ordering: %s, Steady: %s, Failover: %s (winner %u), Alone: %s"),
+        bWireOk ? TEXT("OK") : TEXT("FAIL"), bOrderOk ? TEXT("OK") : TEXT("FAIL"), bSteadyOk ? TEXT("OK") : TEXT("FAIL"),
+        bFailoverOk ? TEXT("OK") : TEXT("FAIL"), AfterFailure, bAloneOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Master Election"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestHoldover()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Holdover"), TEXT("Holdover: Testing..."));
+
+    // Locked samples with 10us phase noise and 1ppm frequency wander
+    FTimecodeHoldoverModel Model;
+    for (int32 Index = 0; Index < 200; ++Index)
+    {
+        Model.AddSample((Index % 2) ? 10e-6 : -10e-6, (Index % 2) ? 1e-6 : -1e-6);
+    }
+    const bool bModelOk = FMath::IsNearlyEqual(Model.PhaseJitter, 10e-6, 1e-7) &&
+        FMath::IsNearlyEqual(Model.FrequencyError, 1e-6, 1e-8);
+
+    // The bound starts at the phase jitter and grows with time
+    const double AtStart = Model.GetUncertainty(0.0);
+    const double AfterMinute = Model.GetUncertainty(60.0);
+    const double AfterHour = Model.GetUncertainty(3600.0);
+    const bool bGrowthOk = FMath::IsNearlyEqual(AtStart, 10e-6, 1e-7) && AfterMinute > AtStart && AfterHour > AfterMinute &&
+        FMath::IsNearlyEqual(AfterMinute, 10e-6 + 60e-6 + 0.5 * FTimecodeHoldoverModel::FrequencyDrift * 3600.0, 1e-7);
+
+    // Recovery slews proportionally but never faster than the limit
+    const double MaxSlew = 500e-6;
+    const bool bSlewOk =
+        FMath::IsNearlyEqual(FTimecodeHoldoverModel::GetSlewFrequency(100e-6, MaxSlew), 100e-6 / FTimecodeHoldoverModel::SlewTimeConstant) &&
+        FTimecodeHoldoverModel::GetSlewFrequency(0.01, MaxSlew) == MaxSlew &&
+        FTimecodeHoldoverModel::GetSlewFrequency(-0.01, MaxSlew) == -MaxSlew;
+
+    // The PLL object keeps its learned frequency while samples are missing
+    UPLLSynchronizer* PLL = NewObject<UPLLSynchronizer>();
+    PLL->Initialize();
+    PLL->ProcessTime(10.0f, 10.001f, 0.033f);
+    const float Learned = PLL->GetFrequencyAdjustment();
+    for (int32 Index = 0; Index < 100; ++Index)
+    {
+        PLL->Update(0.033f);
+    }
+    const bool bHeldOk = Learned != 1.0f && PLL->GetFrequencyAdjustment() == Learned &&
+        PLL->IsInHoldover() && PLL->GetHoldoverDuration() > 3.0f;
+
+    PLL->ProcessTime(13.3f, 13.3f, 0.033f);
+    const bool bResumedOk = !PLL->IsInHoldover() && PLL->GetHoldoverDuration() == 0.0f;
+
+    const bool bSuccess = bModelOk && bGrowthOk && bSlewOk && bHeldOk && bResumedOk;
+    const FString ResultMessage = FString::Printf(TEXT("Model: %s, Growth: %s (%.1fus after 60s), Slew limit: %s, Held frequency: %s, Resume: %s"),
+        bModelOk ? TEXT("OK") : TEXT("FAIL"), bGrowthOk ? TEXT("OK") : TEXT("FAIL"), AfterMinute * 1e6,
+        bSlewOk ? TEXT("OK") : TEXT("FAIL"), bHeldOk ? TEXT("OK") : TEXT("FAIL"), bResumedOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Holdover"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestTransportCommand()
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Transport Command"), TEXT("Transport Command: Testing..."));
+
+    // Command payload survives the wire round trip
+    FTimecodeTransportInfo Sent;
+    Sent.PreviousSeconds = 3600.25;
+    Sent.TimecodeSeconds = 120.5;
+    Sent.PlaybackRate = -2.0;
+    Sent.Generation = 7;
+
+    uint8 Payload[FTimecodeTransportInfo::PayloadSize];
+    FTimecodeMessageView Command;
+    Command.MessageType = ETimecodeMessageType::Command;
+    Command.Flags = TimecodeWire::FlagTransport;
+    Command.Payload = Payload;
+    Command.PayloadLength = static_cast<uint16>(Sent.Encode(Payload));
+
+    uint8 Buffer[TimecodeWire::HeaderSize + FTimecodeTransportInfo::PayloadSize];
+    FTimecodeMessageView DecodedView;
+    FTimecodeTransportInfo Received;
+    const bool bWireOk = FTimecodeMessageView::Decode(MakeArrayView(Buffer, Command.Encode(Buffer)), DecodedView) &&
+        Received.Decode(DecodedView) && Received.PreviousSeconds == 3600.25 && Received.TimecodeSeconds == 120.5 &&
+        Received.PlaybackRate == -2.0 && Received.Generation == 7 && Received.IsJump() && DecodedView.GetPayloadString().IsEmpty();
+
+    // Other commands (mode change strings) are not taken for transport
+    FTimecodeMessageView ModeCommand = Command;
+    ModeCommand.Flags = 0;
+    FTimecodeTransportInfo Ignored;
+    const bool bFilterOk = !Ignored.Decode(ModeCommand);
+
+    // Generations: a repeat or a reordered older command is not newer, the counter may wrap, 0 is never sent
+    FTimecodeTransportInfo Wrapped;
+    Wrapped.Generation = 2;
+    FTimecodeTransportInfo Unset;
+    uint8 UnsetPayload[FTimecodeTransportInfo::PayloadSize];
+    FTimecodeMessageView UnsetCommand = Command;
+    UnsetCommand.Payload = UnsetPayload;
+    UnsetCommand.PayloadLength = static_cast<uint16>(Unset.Encode(UnsetPayload));
+    const bool bGenerationOk = Received.IsNewerThan(0) && Received.IsNewerThan(6) && !Received.IsNewerThan(7) &&
+        !Received.IsNewerThan(8) && Wrapped.IsNewerThan(0xFFFFFFF0u) && !Ignored.Decode(UnsetCommand);
+
+    // Rebase: the servo keeps its clock and the timecode reads the target at the command's master time
+    FTimecodeServoSnapshot Snapshot;
+    Snapshot.MasterTime = 1000.0;
+    Snapshot.LocalTime = 50.0;
+    Snapshot.TimecodeSeconds = 10.0;
+    Snapshot.Frequency = 1.0;
+
+    FTimecodeServoSnapshot Forward = Snapshot;
+    Forward.Rebase(1001.0, 500.0, 2.0);
+    const bool bForwardOk = FMath::IsNearlyEqual(Forward.GetTimecodeSeconds(51.0), 500.0, 1e-9) &&
+        FMath::IsNearlyEqual(Forward.GetTimecodeSeconds(52.0), 502.0, 1e-9) && Forward.GetMasterTime(51.0) == 1001.0;
+
+    FTimecodeServoSnapshot Reverse = Snapshot;
+    Reverse.Rebase(1001.0, 500.0, -1.0);
+    const bool bReverseOk = FMath::IsNearlyEqual(Reverse.GetTimecodeSeconds(52.0), 499.0, 1e-9);
+
+    const bool bSuccess = bWireOk && bFilterOk && bGenerationOk && bForwardOk && bReverseOk;
+    const FString ResultMessage = FString::Printf(TEXT("Wire: %s, Filter: %s, Generation: %s, Forward rebase: %s, Reverse rebase: %s"),
+        bWireOk ? TEXT("OK") : TEXT("FAIL"), bFilterOk ? TEXT("OK") : TEXT("FAIL"), bGenerationOk ? TEXT("OK") : TEXT("FAIL"),
+        bForwardOk ? TEXT("OK") : TEXT("FAIL"), bReverseOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Transport Command"), bSuccess, ResultMessage);
+    return bSuccess;
+}
+
+bool UTimecodeSyncNetworkTest::TestRelayToggle(int32 Port)
+{
+    UTimecodeSyncTestLogger::Get()->LogInfo(TEXT("Relay Toggle"), TEXT("Relay Toggle: Testing..."));
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!SocketSubsystem)
+    {
+        LogTestResult(TEXT("Relay Toggle"), false, TEXT("Socket subsystem not found"));
+        return false;
+    }
+
+    // Slave that switches to relay at runtime (reopens its socket)
+    UTimecodeNetworkManager* Node = NewObject<UTimecodeNetworkManager>(this);
+    Node->SetRoleMode(ETimecodeRoleMode::Manual);
+    Node->SetManualMaster(false);
+    const bool bInitOk = Node->Initialize(false, Port);
+    Node->SetRelayMode(true);
+    const bool bRelayOk = bInitOk && Node->IsRelay() && !Node->IsMaster() &&
+        Node->GetConnectionState() == ENetworkConnectionState::Connected;
+
+    // Upstream master sync sent straight to the node's port
+    FTimecodeMessageView Sync;
+    Sync.MessageType = ETimecodeMessageType::TimecodeSync;
+    Sync.SetTimecode(TEXT("01:00:00:00"), 30.0f);
+    Sync.SenderID = 0xCAFE0002;
+    Sync.Sequence = 1;
+    Sync.Timestamp = FPlatformTime::Seconds();
+
+    uint8 Wire[TimecodeWire::MaxMessageSize];
+    const int32 WireSize = Sync.Encode(Wire);
+
+    FSocket* SenderSocket = FUdpSocketBuilder(TEXT("TimecodeSyncRelaySender")).AsNonBlocking().AsReusable();
+    TSharedRef<FInternetAddr> TargetAddr = SocketSubsystem->CreateInternetAddr();
+    TargetAddr->SetLoopbackAddress();
+    TargetAddr->SetPort(Port);
+
+    int32 BytesSent = 0;
+    const bool bSendOk = SenderSocket && SenderSocket->SendTo(Wire, WireSize, BytesSent, *TargetAddr);
+
+    // The receive thread feeds the servo; the game thread drains the inbox on Tick
+    bool bReceivedOk = false;
+    const double Deadline = FPlatformTime::Seconds() + 1.0;
+    while (bSendOk && !bReceivedOk && FPlatformTime::Seconds() < Deadline)
+    {
+        FPlatformProcess::Sleep(0.01f);
+        Node->Tick(0.01f);
+        bReceivedOk = Node->HasReceivedValidMessage() && Node->GetServoSnapshot().IsValid();
+    }
+
+    if (SenderSocket)
+    {
+        SocketSubsystem->DestroySocket(SenderSocket);
+    }
+    Node->Shutdown();
+
+    const bool bSuccess = bRelayOk && bSendOk && bReceivedOk;
+    const FString ResultMessage = FString::Printf(TEXT("Relay switch: %s, Send: %s, Sync received after switch: %s"),
+        bRelayOk ? TEXT("OK") : TEXT("FAIL"), bSendOk ? TEXT("OK") : TEXT("FAIL"), bReceivedOk ? TEXT("OK") : TEXT("FAIL"));
+
+    LogTestResult(TEXT("Relay Toggle"), bSuccess, ResultMessage);
+    return bSuccess;
+}
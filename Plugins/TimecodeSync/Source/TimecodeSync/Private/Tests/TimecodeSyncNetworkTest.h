@@ -34,6 +34,46 @@ public:
     UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
     bool TestPacketLoss(float LossPercentage = 20.0f);
 
+    // Sequence number gap/reorder/duplicate detection test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestSequenceTracking();
+
+    // Receive inbox ordering and overflow policy test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestPacketInbox();
+
+    // Round-trip delay and offset from Delay_Req/Delay_Resp timestamps
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestDelayMeasurement();
+
+    // Minimum-delay / delay-weighted clock filter test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestClockFilter();
+
+    // Unicast fan-out slave registry test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestSlaveRegistry();
+
+    // Relay correction field (path delay + residence time) test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestRelayCorrection();
+
+    // Best-master election ordering and failover test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestMasterElection();
+
+    // Holdover error bound, recovery slew limit and held PLL frequency test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestHoldover();
+
+    // Transport command payload and slave servo rebase (seek, playback rate) test
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestTransportCommand();
+
+    // Runtime relay toggle keeps the node receiving (localhost)
+    UFUNCTION(BlueprintCallable, Category = "TimecodeSyncTest")
+    bool TestRelayToggle(int32 Port = 12360);
+
 private:
     // Log helper function
     void LogTestResult(const FString& TestName, bool bSuccess, const FString& Message = TEXT(""));
@@ -283,6 +283,86 @@ void ATimecodeSyncTestActor::RunIntegratedTest()
 
         TestResults.Add(FString::Printf(TEXT("Packet Loss Handling: %s"),
             PacketLossResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 시퀀스 추적 테스트
+        TotalTests++;
+        bool SequenceResult = NetworkTest->TestSequenceTracking();
+        if (SequenceResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Sequence Tracking: %s"),
+            SequenceResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 수신 인박스 테스트
+        TotalTests++;
+        bool InboxResult = NetworkTest->TestPacketInbox();
+        if (InboxResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Packet Inbox: %s"),
+            InboxResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 왕복 지연 측정 테스트
+        TotalTests++;
+        bool DelayResult = NetworkTest->TestDelayMeasurement();
+        if (DelayResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Delay Measurement: %s"),
+            DelayResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 클럭 필터 테스트
+        TotalTests++;
+        bool ClockFilterResult = NetworkTest->TestClockFilter();
+        if (ClockFilterResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Clock Filter: %s"),
+            ClockFilterResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 슬레이브 레지스트리 (유니캐스트 팬아웃) 테스트
+        TotalTests++;
+        bool SlaveRegistryResult = NetworkTest->TestSlaveRegistry();
+        if (SlaveRegistryResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Slave Registry: %s"),
+            SlaveRegistryResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 릴레이 보정값 테스트
+        TotalTests++;
+        bool RelayCorrectionResult = NetworkTest->TestRelayCorrection();
+        if (RelayCorrectionResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Relay Correction: %s"),
+            RelayCorrectionResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 마스터 선출 테스트
+        TotalTests++;
+        bool MasterElectionResult = NetworkTest->TestMasterElection();
+        if (MasterElectionResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Master Election: %s"),
+            MasterElectionResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 홀드오버 테스트
+        TotalTests++;
+        bool HoldoverResult = NetworkTest->TestHoldover();
+        if (HoldoverResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Holdover: %s"),
+            HoldoverResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 탐색/재생 속도 명령 테스트
+        TotalTests++;
+        bool TransportResult = NetworkTest->TestTransportCommand();
+        if (TransportResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Transport Command: %s"),
+            TransportResult ? TEXT("PASSED") : TEXT("FAILED")));
+
+        // 실행 중 릴레이 전환 후 수신 테스트
+        TotalTests++;
+        bool RelayToggleResult = NetworkTest->TestRelayToggle();
+        if (RelayToggleResult) PassedTests++;
+
+        TestResults.Add(FString::Printf(TEXT("Relay Toggle: %s"),
+            RelayToggleResult ? TEXT("PASSED") : TEXT("FAILED")));
     }
 
     // 3. 마스터/슬레이브 동기화 테스트
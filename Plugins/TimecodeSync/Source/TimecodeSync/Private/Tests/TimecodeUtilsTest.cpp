@@ -109,17 +109,21 @@ bool FDropFrameTimecodeTest::RunTest(const FString& Parameters)
 {
     // 29.97fps drop frame test cases
 
-    // Test case: exactly 1 minute (becomes "00:01:00;02" due to frame drop)
+    // Test case: 60 seconds is frame 1798.2, two frames before the first label of minute 1
     FString Timecode60sec = UTimecodeUtils::SecondsToTimecode(60.0f, 29.97f, true);
-    TestEqual("60 seconds at 29.97fps drop frame should be 00:01:00;02", Timecode60sec, TEXT("00:01:00;02"));
+    TestEqual("60 seconds at 29.97fps drop frame should be 00:00:59;28", Timecode60sec, TEXT("00:00:59;28"));
+
+    // Test case: minute 1 starts at frame 1800 with label ;02 (labels ;00 and ;01 are dropped)
+    TestTrue("00:01:00;02 at 29.97fps drop frame should be frame 1800 (60.06 seconds)",
+        FMath::IsNearlyEqual(UTimecodeUtils::TimecodeToSeconds(TEXT("00:01:00;02"), 29.97f, true), 60.06f, 0.001f));
 
     // Test case: 10 minutes (no frame drop as it's a multiple of 10)
     FString Timecode10min = UTimecodeUtils::SecondsToTimecode(600.0f, 29.97f, true);
     TestEqual("10 minutes at 29.97fps drop frame should be 00:10:00;00", Timecode10min, TEXT("00:10:00;00"));
 
-    // Test case: 11 minutes (becomes "00:11:00;02" due to frame drop)
+    // Test case: 11 minutes is frame 19780.2, again just before the dropped labels of minute 11
     FString Timecode11min = UTimecodeUtils::SecondsToTimecode(660.0f, 29.97f, true);
-    TestEqual("11 minutes at 29.97fps drop frame should be 00:11:00;02", Timecode11min, TEXT("00:11:00;02"));
+    TestEqual("11 minutes at 29.97fps drop frame should be 00:10:59;28", Timecode11min, TEXT("00:10:59;28"));
 
     // Round-trip conversion test
     float TimeValues[] = { 59.94f, 60.0f, 600.0f, 660.0f, 3600.0f, 3660.0f };
@@ -135,7 +139,17 @@ bool FDropFrameTimecodeTest::RunTest(const FString& Parameters)
 
     // Add 59.94fps test case
     FString Timecode60sec_59_94 = UTimecodeUtils::SecondsToTimecode(60.0f, 59.94f, true);
-    TestEqual("60 seconds at 59.94fps drop frame should be 00:01:00;04", Timecode60sec_59_94, TEXT("00:01:00;04"));
+    TestEqual("60 seconds at 59.94fps drop frame should be 00:00:59;56", Timecode60sec_59_94, TEXT("00:00:59;56"));
+
+    // First label of a dropping minute survives a round trip at every drop frame rate
+    const TCHAR* MinuteLabels[] = { TEXT("00:01:00;02"), TEXT("00:01:00;04"), TEXT("00:01:00;08") };
+    const float DropFrameRates[] = { 29.97f, 59.94f, 119.88f };
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(DropFrameRates); ++Index)
+    {
+        const float Seconds = UTimecodeUtils::TimecodeToSeconds(MinuteLabels[Index], DropFrameRates[Index], true);
+        TestEqual(FString::Printf(TEXT("Label round trip at %g fps drop frame"), DropFrameRates[Index]),
+            UTimecodeUtils::SecondsToTimecode(Seconds, DropFrameRates[Index], true), FString(MinuteLabels[Index]));
+    }
 
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,151 @@
+﻿// TimecodeValueTest.cpp
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TimecodeValue.h"
+
+// Labels are computed at compile time
+static_assert(FTimecodeValue::FromFrameRate(29.97f, true).RateNumerator == 30000, "29.97 maps to 30000/1001");
+static_assert(FTimecodeValue::FromFrameRate(25.0f, true).RateDenominator == 1 && !FTimecodeValue::FromFrameRate(25.0f, true).bDropFrame,
+    "Integer rates never drop frames");
+static_assert(FTimecodeValue(1800, 30000, 1001, true).ToFields().Minutes == 1 && FTimecodeValue(1800, 30000, 1001, true).ToFields().Frames == 2,
+    "Frame 1800 at 29.97 DF is 00:01:00;02");
+static_assert(FTimecodeValue(17982, 30000, 1001, true).ToFields().Minutes == 10 && FTimecodeValue(17982, 30000, 1001, true).ToFields().Frames == 0,
+    "Frame 17982 at 29.97 DF is 00:10:00;00");
+static_assert(FTimecodeValue(7200, 120000, 1001, true).ToFields().Minutes == 1 && FTimecodeValue(7200, 120000, 1001, true).ToFields().Frames == 8,
+    "Frame 7200 at 119.88 DF is 00:01:00;08");
+static_assert(!FTimecodeValue::FromFrameRate(23.976f, true).bDropFrame && FTimecodeValue::FromFrameRate(47.952f, false).RateNumerator == 48000,
+    "Pull-down rates are non-drop x000/1001");
+static_assert(FTimecodeValue::Parse(TEXT(" 01:02:03;04 "), 13).Fields.Frames == 4 && FTimecodeValue::Parse(TEXT("01:02:03;04"), 11).bDropFrame,
+    "Labels parse at compile time");
+
+// Integer frame-count timecode: drop frame labelling, round trips and long-run precision
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimecodeValueTest, "TimecodeSync.Utils.TimecodeValue", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTimecodeValueTest::RunTest(const FString& Parameters)
+{
+    // 1. At every standard rate, each frame of a 24-hour day survives frame -> label -> frame,
+    //    and no skipped or out-of-range label is produced
+    {
+        for (const FTimecodeRate& Rate : FTimecodeValue::StandardRates)
+        {
+            const int32 Drop = Rate.DropFramesPerMinute;
+            const int64 FramesPerDay = static_cast<int64>(24 * 3600 * Rate.GetFrameRate());
+
+            int64 Failures = 0;
+            for (int64 Frame = 0; Frame < FramesPerDay; ++Frame)
+            {
+                const FTimecodeFields Fields = FTimecodeValue(Frame, Rate.Numerator, Rate.Denominator, Rate.IsDropFrame()).ToFields();
+                const bool bSkippedLabel = Fields.Seconds == 0 && Fields.Minutes % 10 != 0 && Fields.Frames < Drop;
+                if (bSkippedLabel || Fields.Frames >= Rate.NominalFps ||
+                    FTimecodeValue::FromFields(Fields, Rate.Numerator, Rate.Denominator, Rate.IsDropFrame()).FrameNumber != Frame)
+                {
+                    ++Failures;
+                }
+            }
+            TestEqual(FString::Printf(TEXT("Round trip at %d/%d%s"), Rate.Numerator, Rate.Denominator, Rate.IsDropFrame() ? TEXT(" DF") : TEXT("")),
+                Failures, 0LL);
+        }
+    }
+
+    // 2. Labels at known points
+    {
+        TestEqual(TEXT("1.5s at 30fps"), FTimecodeValue::FromSeconds(1.5, 30.0f, false).ToString(), TEXT("00:00:01:15"));
+        TestEqual(TEXT("59.9s at 30fps"), FTimecodeValue::FromSeconds(59.9f, 30.0f, false).ToString(), TEXT("00:00:59:27"));
+        TestEqual(TEXT("1 hour at 29.97 DF"), FTimecodeValue::FromSeconds(3600.0, 29.97f, true).ToString(), TEXT("01:00:00;00"));
+        TestEqual(TEXT("1 minute of labels at 59.94 DF"), FTimecodeValue(3600, 60000, 1001, true).ToString(), TEXT("00:01:00;04"));
+        TestEqual(TEXT("Drop flag ignored at 25fps"), FTimecodeValue::FromSeconds(60.0, 25.0f, true).ToString(), TEXT("00:01:00:00"));
+    }
+
+    // 3. Frame boundaries stay exact after 10 hours (a float only resolves ~4ms steps there)
+    {
+        const FTimecodeValue Late = FTimecodeValue::FromSeconds(36000.0 + 15.0 / 30.0, 30, 1, false);
+        TestEqual(TEXT("Frame number after 10 hours"), Late.FrameNumber, 36000LL * 30 + 15);
+        TestEqual(TEXT("Label after 10 hours"), Late.ToString(), TEXT("10:00:00:15"));
+        TestEqual(TEXT("Frame start after 10 hours"), Late.ToSeconds(), 36000.5);
+    }
+
+    // 4. The lookup-table formatter matches Printf and always writes 11 characters
+    {
+        int32 Mismatches = 0;
+        for (int64 Frame = 0; Frame < 30 * 3600; Frame += 7)
+        {
+            const FTimecodeValue Value(Frame, 30000, 1001, true);
+            const FTimecodeFields Fields = Value.ToFields();
+            TCHAR Buffer[FTimecodeValue::FormattedLength + 1];
+            if (Value.FormatTo(Buffer) != 11 ||
+                FString(Buffer) != FString::Printf(TEXT("%02d:%02d:%02d;%02d"), Fields.Hours, Fields.Minutes, Fields.Seconds, Fields.Frames))
+            {
+                ++Mismatches;
+            }
+        }
+        TestEqual(TEXT("FormatTo matches Printf"), Mismatches, 0);
+        TestEqual(TEXT("Last label of the day"), FTimecodeValue(24LL * 3600 * 25 - 1, 25, 1, false).ToString(), TEXT("23:59:59:24"));
+        TestEqual(TEXT("Hours wrap at 24"), FTimecodeValue(25LL * 3600 * 25, 25, 1, false).ToString(), TEXT("01:00:00:00"));
+        TestEqual(TEXT("101 hours is day 5, 05:00"), FTimecodeValue(101LL * 3600 * 25, 25, 1, false).ToString(), TEXT("05:00:00:00"));
+    }
+
+    // 5. The single-pass parser reads both encodings and reports where a label goes wrong
+    {
+        const FTimecodeParseResult Wide = FTimecodeValue::Parse(FStringView(TEXT("\t12:34:56;07\n")));
+        TestTrue(TEXT("Wide label parsed"), Wide.IsValid() && Wide.bDropFrame && Wide.bCanonicalFields);
+        TestEqual(TEXT("Wide label minutes"), Wide.Fields.Minutes, 34);
+
+        const FTimecodeParseResult Utf8 = FTimecodeValue::Parse(FUtf8StringView(UTF8TEXT("1:2:3:4")));
+        TestTrue(TEXT("Short fields parsed"), Utf8.IsValid() && !Utf8.bCanonicalFields && !Utf8.bDropFrame);
+        TestEqual(TEXT("UTF-8 label frames"), Utf8.Fields.Frames, 4);
+
+        struct FErrorCase
+        {
+            const TCHAR* Label;
+            ETimecodeParseError Error;
+            int32 Position;
+        };
+        const FErrorCase Cases[] =
+        {
+            { TEXT("   "), ETimecodeParseError::Empty, 3 },
+            { TEXT("00:00:00"), ETimecodeParseError::MissingField, 8 },
+            { TEXT("00:00:00:"), ETimecodeParseError::MissingField, 9 },
+            { TEXT("00-00:00:00"), ETimecodeParseError::InvalidCharacter, 2 },
+            { TEXT("00:0a:00:00"), ETimecodeParseError::InvalidCharacter, 4 },
+            { TEXT("000:00:00:00"), ETimecodeParseError::FieldTooLong, 2 },
+            { TEXT("00:00:00:0000"), ETimecodeParseError::FieldTooLong, 12 },
+            { TEXT("00:00:00:00 x"), ETimecodeParseError::TrailingCharacters, 11 },
+            { TEXT("00:60:00:00"), ETimecodeParseError::OutOfRange, 3 },
+            { TEXT(" 00:00:75:00"), ETimecodeParseError::OutOfRange, 7 },
+        };
+        for (const FErrorCase& Case : Cases)
+        {
+            const FTimecodeParseResult Result = FTimecodeValue::Parse(FStringView(Case.Label));
+            TestEqual(FString::Printf(TEXT("Error for '%s'"), Case.Label), static_cast<int32>(Result.Error), static_cast<int32>(Case.Error));
+            TestEqual(FString::Printf(TEXT("Position for '%s'"), Case.Label), Result.Position, Case.Position);
+        }
+    }
+
+    // 6. Above 100 fps the frames field has three digits, and those labels parse back to the same frame
+    {
+        const bool DropModes[] = { false, true };
+        for (const bool bDrop : DropModes)
+        {
+            int32 Failures = 0;
+            for (int64 Frame = 0; Frame < 120 * 70; ++Frame)
+            {
+                const FTimecodeValue Value(Frame, 120000, 1001, bDrop);
+                const FString Label = Value.ToString();
+                const FTimecodeParseResult Parsed = FTimecodeValue::Parse(FStringView(Label));
+                if (Label.Len() != 12 || !Parsed.IsValid() || !Parsed.bCanonicalFields || Parsed.bDropFrame != bDrop ||
+                    Parsed.Fields.Frames != Value.ToFields().Frames ||
+                    FTimecodeValue::FromFields(Parsed.Fields, 120000, 1001, bDrop).FrameNumber != Frame)
+                {
+                    ++Failures;
+                }
+            }
+            TestEqual(FString::Printf(TEXT("Three digit labels round trip at 119.88%s"), bDrop ? TEXT(" DF") : TEXT("")), Failures, 0);
+        }
+
+        TestEqual(TEXT("Frame 115 at 119.88"), FTimecodeValue(115, 120000, 1001, false).ToString(), TEXT("00:00:00:115"));
+        TestEqual(TEXT("Frame 5 at 120"), FTimecodeValue(5, 120, 1, false).ToString(), TEXT("00:00:00:005"));
+        TestEqual(TEXT("Two digits at 60"), FTimecodeValue(59, 60, 1, false).ToString(), TEXT("00:00:00:59"));
+    }
+
+    return true;
+}
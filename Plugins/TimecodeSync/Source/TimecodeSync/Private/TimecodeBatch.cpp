@@ -0,0 +1,215 @@
+﻿#include "TimecodeBatch.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    constexpr int32 Lanes = 4;
+
+    // Seconds are converted in stack blocks of this many frames
+    constexpr int32 SecondsBlockSize = 256;
+
+    FORCEINLINE FTimecodePackedFields PackFields(const FTimecodeFields& Fields)
+    {
+        FTimecodePackedFields Packed;
+        Packed.Hours = static_cast<uint8>(Fields.Hours % 100);
+        Packed.Minutes = static_cast<uint8>(Fields.Minutes);
+        Packed.Seconds = static_cast<uint8>(Fields.Seconds);
+        Packed.Frames = static_cast<uint8>(Fields.Frames);
+        return Packed;
+    }
+
+    FORCEINLINE FTimecodePackedFields ScalarFrameToFields(int64 FrameNumber, const FTimecodeRate& Rate)
+    {
+        return PackFields(FTimecodeValue(FrameNumber, Rate.Numerator, Rate.Denominator, Rate.IsDropFrame()).ToFields());
+    }
+
+    // Frame containing a point in time, as FTimecodeValue::FromSeconds
+    FORCEINLINE int64 ScalarSecondsToFrame(double Seconds, const FTimecodeRate& Rate)
+    {
+        const double Frames = Seconds * Rate.Numerator / Rate.Denominator + 1e-6;
+        return Frames > 0.0 ? static_cast<int64>(Frames) : 0;
+    }
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+    // floor(X / Divisor) for whole numbers below 2^23; one step corrects the reciprocal's rounding.
+    // Also returns X - Quotient * Divisor.
+    FORCEINLINE VectorRegister4Float VectorFloorDivide(const VectorRegister4Float& X, const VectorRegister4Float& Divisor,
+        const VectorRegister4Float& Reciprocal, VectorRegister4Float& OutRemainder)
+    {
+        VectorRegister4Float Quotient = VectorFloor(VectorMultiply(X, Reciprocal));
+        VectorRegister4Float Remainder = VectorSubtract(X, VectorMultiply(Quotient, Divisor));
+
+        const VectorRegister4Float Over = VectorBitwiseAnd(VectorCompareGE(Remainder, Divisor), VectorOne());
+        const VectorRegister4Float Under = VectorBitwiseAnd(VectorCompareLT(Remainder, VectorZero()), VectorOne());
+        const VectorRegister4Float Step = VectorSubtract(Over, Under);
+        OutRemainder = VectorSubtract(Remainder, VectorMultiply(Step, Divisor));
+        return VectorAdd(Quotient, Step);
+    }
+
+    // Same for quotients below 2^13: X + 0.5 keeps every exact quotient clear of the product's rounding
+    FORCEINLINE VectorRegister4Float VectorFloorDivideSmall(const VectorRegister4Float& X, const VectorRegister4Float& Divisor,
+        const VectorRegister4Float& Reciprocal, VectorRegister4Float& OutRemainder)
+    {
+        const VectorRegister4Float Quotient = VectorFloor(VectorMultiply(VectorAdd(X, GlobalVectorConstants::FloatOneHalf), Reciprocal));
+        OutRemainder = VectorSubtract(X, VectorMultiply(Quotient, Divisor));
+        return Quotient;
+    }
+
+    // Rate constants splatted across the lanes
+    struct FVectorRate
+    {
+        VectorRegister4Float Nominal, NominalReciprocal;
+        VectorRegister4Float Drop, DropTimesNine;
+        VectorRegister4Float PerMinute, PerMinuteReciprocal;
+        VectorRegister4Float Per10Minutes, Per10MinutesReciprocal;
+        VectorRegister4Float Sixty, SixtyReciprocal;
+        VectorRegister4Float ByteShift, TwoByteShift;
+
+        explicit FVectorRate(const FTimecodeRate& Rate)
+            : Nominal(VectorSetFloat1(static_cast<float>(Rate.NominalFps)))
+            , NominalReciprocal(VectorSetFloat1(1.0f / Rate.NominalFps))
+            , Drop(VectorSetFloat1(static_cast<float>(Rate.DropFramesPerMinute)))
+            , DropTimesNine(VectorSetFloat1(static_cast<float>(Rate.DropFramesPerMinute * 9)))
+            , PerMinute(VectorSetFloat1(static_cast<float>(Rate.FramesPerMinute)))
+            , PerMinuteReciprocal(VectorSetFloat1(1.0f / Rate.FramesPerMinute))
+            , Per10Minutes(VectorSetFloat1(static_cast<float>(Rate.FramesPer10Minutes)))
+            , Per10MinutesReciprocal(VectorSetFloat1(1.0f / Rate.FramesPer10Minutes))
+            , Sixty(VectorSetFloat1(60.0f))
+            , SixtyReciprocal(VectorSetFloat1(1.0f / 60.0f))
+            , ByteShift(VectorSetFloat1(256.0f))
+            , TwoByteShift(VectorSetFloat1(65536.0f))
+        {
+        }
+    };
+
+    /**
+     * FTimecodeValue::ToFields for four frame numbers in [0, MaxVectorFrame)
+     * At 24 fps and above that is less than 100 hours, so no hours wrap is needed.
+     */
+    template <bool bDropFrame>
+    FORCEINLINE void VectorFramesToFields(const int64* Frames, const FVectorRate& Rate, FTimecodePackedFields* OutFields)
+    {
+        VectorRegister4Float Labels = MakeVectorRegisterFloat(static_cast<float>(Frames[0]), static_cast<float>(Frames[1]),
+            static_cast<float>(Frames[2]), static_cast<float>(Frames[3]));
+
+        // Add back the labels skipped before each frame
+        if (bDropFrame)
+        {
+            VectorRegister4Float Remainder;
+            VectorRegister4Float Unused;
+            const VectorRegister4Float Blocks = VectorFloorDivide(Labels, Rate.Per10Minutes, Rate.Per10MinutesReciprocal, Remainder);
+            const VectorRegister4Float Minute = VectorFloorDivide(VectorMax(VectorSubtract(Remainder, Rate.Drop), VectorZero()),
+                Rate.PerMinute, Rate.PerMinuteReciprocal, Unused);
+            Labels = VectorAdd(Labels, VectorAdd(VectorMultiply(Blocks, Rate.DropTimesNine), VectorMultiply(Minute, Rate.Drop)));
+        }
+
+        VectorRegister4Float FrameField;
+        VectorRegister4Float SecondField;
+        VectorRegister4Float MinuteField;
+        const VectorRegister4Float TotalSeconds = VectorFloorDivide(Labels, Rate.Nominal, Rate.NominalReciprocal, FrameField);
+        const VectorRegister4Float TotalMinutes = VectorFloorDivideSmall(TotalSeconds, Rate.Sixty, Rate.SixtyReciprocal, SecondField);
+        const VectorRegister4Float HourField = VectorFloorDivideSmall(TotalMinutes, Rate.Sixty, Rate.SixtyReciprocal, MinuteField);
+
+        // Hours + Minutes * 2^8 + Seconds * 2^16 stays below 2^24, so the float sum is exact; the
+        // frames byte is shifted in as an integer. Four packed labels leave in one 16 byte store
+        // (little-endian field order, as on every supported target).
+        const VectorRegister4Float LowBytes = VectorAdd(HourField,
+            VectorAdd(VectorMultiply(MinuteField, Rate.ByteShift), VectorMultiply(SecondField, Rate.TwoByteShift)));
+        VectorIntStore(VectorIntOr(VectorFloatToInt(LowBytes), VectorShiftLeftImm(VectorFloatToInt(FrameField), 24)), OutFields);
+    }
+
+    // Vector loop over whole groups of four; returns the number of frames handled
+    template <bool bDropFrame>
+    int32 VectorFramesToFieldsLoop(TArrayView<const int64> FrameNumbers, const FTimecodeRate& Rate, TArrayView<FTimecodePackedFields> OutFields, int32 Count)
+    {
+        const FVectorRate VectorRate(Rate);
+        int32 Index = 0;
+        for (; Index + Lanes <= Count; Index += Lanes)
+        {
+            // MaxVectorFrame is a power of two: one unsigned compare also rejects negative frames
+            const int64* Frames = &FrameNumbers[Index];
+            const bool bInRange = static_cast<uint64>(Frames[0] | Frames[1] | Frames[2] | Frames[3]) < static_cast<uint64>(TimecodeBatch::MaxVectorFrame);
+
+            if (bInRange)
+            {
+                VectorFramesToFields<bDropFrame>(Frames, VectorRate, &OutFields[Index]);
+            }
+            else
+            {
+                for (int32 Lane = 0; Lane < Lanes; ++Lane)
+                {
+                    OutFields[Index + Lane] = ScalarFrameToFields(FrameNumbers[Index + Lane], Rate);
+                }
+            }
+        }
+        return Index;
+    }
+#endif
+}
+
+int32 TimecodeBatch::FramesToFields(TArrayView<const int64> FrameNumbers, const FTimecodeRate& Rate, TArrayView<FTimecodePackedFields> OutFields)
+{
+    const int32 Count = FMath::Min(FrameNumbers.Num(), OutFields.Num());
+    int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+    // Below 24 fps the hours could pass 99 inside the vector range; above 255 fps frames do not fit a byte
+    if (Rate.NominalFps >= 24 && Rate.NominalFps <= 255)
+    {
+        Index = Rate.IsDropFrame()
+            ? VectorFramesToFieldsLoop<true>(FrameNumbers, Rate, OutFields, Count)
+            : VectorFramesToFieldsLoop<false>(FrameNumbers, Rate, OutFields, Count);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        OutFields[Index] = ScalarFrameToFields(FrameNumbers[Index], Rate);
+    }
+    return Count;
+}
+
+int32 TimecodeBatch::SecondsToFields(TArrayView<const double> Seconds, const FTimecodeRate& Rate, TArrayView<FTimecodePackedFields> OutFields)
+{
+    const int32 Count = FMath::Min(Seconds.Num(), OutFields.Num());
+
+    int64 Frames[SecondsBlockSize];
+    for (int32 BlockStart = 0; BlockStart < Count; BlockStart += SecondsBlockSize)
+    {
+        const int32 BlockCount = FMath::Min(SecondsBlockSize, Count - BlockStart);
+        for (int32 Index = 0; Index < BlockCount; ++Index)
+        {
+            Frames[Index] = ScalarSecondsToFrame(Seconds[BlockStart + Index], Rate);
+        }
+        FramesToFields(MakeArrayView(Frames, BlockCount), Rate, OutFields.Slice(BlockStart, BlockCount));
+    }
+    return Count;
+}
+
+int32 TimecodeBatch::FieldsToFrames(TArrayView<const FTimecodePackedFields> Fields, const FTimecodeRate& Rate, TArrayView<int64> OutFrameNumbers)
+{
+    // Only a division by ten: a plain loop the compiler can vectorize
+    const int32 Count = FMath::Min(Fields.Num(), OutFrameNumbers.Num());
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FTimecodePackedFields& Label = Fields[Index];
+        const int64 TotalMinutes = static_cast<int64>(Label.Hours) * 60 + Label.Minutes;
+        const int64 Labels = (TotalMinutes * 60 + Label.Seconds) * Rate.NominalFps + Label.Frames;
+        OutFrameNumbers[Index] = Labels - Rate.DropFramesPerMinute * (TotalMinutes - TotalMinutes / 10);
+    }
+    return Count;
+}
+
+int32 TimecodeBatch::FieldsToSeconds(TArrayView<const FTimecodePackedFields> Fields, const FTimecodeRate& Rate, TArrayView<double> OutSeconds)
+{
+    const int32 Count = FMath::Min(Fields.Num(), OutSeconds.Num());
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FTimecodePackedFields& Label = Fields[Index];
+        const int64 TotalMinutes = static_cast<int64>(Label.Hours) * 60 + Label.Minutes;
+        const int64 Labels = (TotalMinutes * 60 + Label.Seconds) * Rate.NominalFps + Label.Frames;
+        const int64 FrameNumber = Labels - Rate.DropFramesPerMinute * (TotalMinutes - TotalMinutes / 10);
+        OutSeconds[Index] = static_cast<double>(FrameNumber) * Rate.Denominator / Rate.Numerator;
+    }
+    return Count;
+}
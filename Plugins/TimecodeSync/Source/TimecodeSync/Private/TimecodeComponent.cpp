@@ -43,6 +43,9 @@ UTimecodeComponent::UTimecodeComponent()
     FrameRate = Settings ? Settings->FrameRate : 30.0f;
     bUseDropFrameTimecode = Settings ? Settings->bUseDropFrameTimecode : false;
     bAutoStart = Settings ? Settings->bAutoStartTimecode : true;
+    bDispatchEventsOnWorkerThread = false;
+    SchedulerFrameRate = 0.0f;
+    bSchedulerDropFrame = false;
 
     // Initialize network settings
     UDPPort = Settings ? Settings->DefaultUDPPort : 10000;
@@ -58,8 +61,12 @@ UTimecodeComponent::UTimecodeComponent()
 
     // Initialize internal variables
     bIsRunning = false;
-    ElapsedTimeSeconds = 0.0f;
+    ElapsedTimeSeconds = 0.0;
     CurrentTimecode = TEXT("00:00:00:00");
+    PlaybackRate = 1.0f;
+    bLoopEnabled = false;
+    LoopStartSeconds = 0.0;
+    LoopEndSeconds = 0.0;
     SyncTimer = 0.0f;
     NetworkManager = nullptr;
     ConnectionState = ENetworkConnectionState::Disconnected;
@@ -116,6 +123,13 @@ void UTimecodeComponent::BeginPlay()
     {
         StartTimecode();
     }
+
+    // 스케줄러 스레드 디스패치
+    if (bDispatchEventsOnWorkerThread)
+    {
+        bDispatchEventsOnWorkerThread = false;
+        SetDispatchEventsOnWorkerThread(true);
+    }
 }
 
 void UTimecodeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -123,12 +137,17 @@ void UTimecodeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     // 먼저 실행 중지
     bIsRunning = false;
 
+    // 스케줄러 스레드 종료
+    EventScheduler.Shutdown();
+
     // 모든 델리게이트 해제
     if (NetworkManager)
     {
         NetworkManager->OnTimecodeMessageReceived.RemoveDynamic(this, &UTimecodeComponent::OnTimecodeMessageReceived);
         NetworkManager->OnNetworkStateChanged.RemoveDynamic(this, &UTimecodeComponent::OnNetworkStateChanged);
         NetworkManager->OnRoleModeChanged.RemoveDynamic(this, &UTimecodeComponent::OnNetworkRoleModeChanged);
+        NetworkManager->OnElectedRoleChanged.RemoveDynamic(this, &UTimecodeComponent::OnNetworkElectedRoleChanged);
+        NetworkManager->OnTransportCommandReceived.RemoveDynamic(this, &UTimecodeComponent::OnNetworkTransportCommand);
 
         // 안전 플래그 설정
         NetworkManager->bIsShuttingDown = true;
@@ -155,6 +174,12 @@ void UTimecodeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
         NetworkManager->Tick(DeltaTime);
     }
 
+    // 블루프린트나 에디터에서 바뀐 프레임 레이트를 스케줄러 스레드에 반영
+    if (EventScheduler.IsThreadRunning())
+    {
+        SyncEventSchedulerFrameRate();
+    }
+
     // 타임코드가 실행 중일 때만 업데이트
     if (bIsRunning)
     {
@@ -184,6 +209,33 @@ void UTimecodeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
             PLLSynchronizer->Update(DeltaTime);
         }
 
+        // 슬레이브: 수신 스레드가 게시한 서보 스냅샷에서 경과 시간을 외삽 (게임 스레드 대기 지연 없음)
+        if (!bIsMaster && NetworkManager)
+        {
+            const FTimecodeServoSnapshot Servo = NetworkManager->GetServoSnapshot();
+            if (Servo.IsValid())
+            {
+                ElapsedTimeSeconds = Servo.GetTimecodeSeconds(FPlatformTime::Seconds());
+
+                // 역할이 마스터로 바뀌어도 시간축이 이어지도록 마스터 클럭을 맞춰 둠
+                MasterClock.SetSeconds(ElapsedTimeSeconds);
+            }
+        }
+
+        // 한 틱에서 발생한 이벤트와 동기 메시지를 하나의 데이터그램으로 묶음
+        const bool bBatchNetwork = bIsMaster && NetworkManager;
+        if (bBatchNetwork)
+        {
+            NetworkManager->BeginBatch();
+        }
+
+        // 루프 구간 끝에서 되감기 (마스터, 같은 틱의 동기 메시지와 한 데이터그램)
+        if (bIsMaster)
+        {
+            ApplyLoopRange();
+            HoldAtTimelineStart();
+        }
+
         // 이벤트 확인 (모든 모드 공통)
         CheckTimecodeEvents();
 
@@ -197,6 +249,17 @@ void UTimecodeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
                 SyncTimer = 0.0f;
             }
         }
+
+        if (bBatchNetwork)
+        {
+            NetworkManager->FlushBatch();
+        }
+
+        // 스케줄러 스레드가 이번 틱의 시간축(슬레이브 서보, PLL 보정 포함)을 따르도록 클럭 복사
+        if (EventScheduler.IsThreadRunning())
+        {
+            EventScheduler.SetClock(MasterClock);
+        }
     }
 }
 
@@ -205,6 +268,8 @@ void UTimecodeComponent::StartTimecode()
     if (!bIsRunning)
     {
         bIsRunning = true;
+        MasterClock.Start();
+        EventScheduler.SetClock(MasterClock);
         UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Timecode started"), *GetOwner()->GetName());
     }
 }
@@ -214,26 +279,26 @@ void UTimecodeComponent::StopTimecode()
     if (bIsRunning)
     {
         bIsRunning = false;
+        MasterClock.Stop();
+        EventScheduler.SetClock(MasterClock);
+        ElapsedTimeSeconds = MasterClock.GetSeconds();
         UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Timecode stopped"), *GetOwner()->GetName());
     }
 }
 
 void UTimecodeComponent::ResetTimecode()
 {
-    ElapsedTimeSeconds = 0.0f;
+    MasterClock.SetSeconds(0.0);
+    ElapsedTimeSeconds = 0.0;
 
     // Update timecode string
-    if (SMPTEConverter)
-    {
-        CurrentTimecode = SMPTEConverter->SecondsToTimecode(ElapsedTimeSeconds, FrameRate, bUseDropFrameTimecode);
-    }
-    else
-    {
-        CurrentTimecode = UTimecodeUtils::SecondsToTimecode(ElapsedTimeSeconds, FrameRate, bUseDropFrameTimecode);
-    }
+    CurrentTimecodeValue = FTimecodeValue::FromSeconds(0.0, FrameRate, bUseDropFrameTimecode);
+    CurrentTimecode = CurrentTimecodeValue.ToString();
 
-    // Reset event trigger states
-    TriggeredEvents.Empty();
+    // Reset event trigger states (every event is pending again from time 0)
+    EventTimeline.Seek(0.0);
+    EventScheduler.SetClock(MasterClock);
+    EventScheduler.Seek(0.0);
 
     // Trigger timecode change event
     OnTimecodeChanged.Broadcast(CurrentTimecode);
@@ -246,16 +311,221 @@ FString UTimecodeComponent::GetCurrentTimecode() const
     return CurrentTimecode;
 }
 
-float UTimecodeComponent::GetCurrentTimeInSeconds() const
+double UTimecodeComponent::GetCurrentTimeInSeconds() const
 {
+    // 틱 사이에서도 호출 시점의 시각을 계산
+    if (bIsRunning)
+    {
+        if (bIsMaster)
+        {
+            // 역재생이 다음 틱에서 0에 멈추기 전까지 음수가 보이지 않도록
+            return FMath::Max(MasterClock.GetSeconds(), 0.0);
+        }
+
+        if (NetworkManager)
+        {
+            const FTimecodeServoSnapshot Servo = NetworkManager->GetServoSnapshot();
+            if (Servo.IsValid())
+            {
+                return Servo.GetTimecodeSeconds(FPlatformTime::Seconds());
+            }
+        }
+    }
+
     return ElapsedTimeSeconds;
 }
 
+bool UTimecodeComponent::CanControlTimeline(const TCHAR* Operation) const
+{
+    // 슬레이브의 시간축은 마스터를 따르므로 마스터에서만 이동
+    if (!bIsMaster)
+    {
+        UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] %s ignored: only the master moves the timeline"),
+            *GetOwner()->GetName(), Operation);
+        return false;
+    }
+    return true;
+}
+
+void UTimecodeComponent::JumpTimeline(double FromSeconds, double TargetSeconds, double SinceTargetSeconds, bool bForwardLoopWrap)
+{
+    // 떠나는 위치까지의 이벤트를 먼저 발생 (정방향 재생일 때만)
+    if (PlaybackRate > 0.0f)
+    {
+        DispatchEventsUpTo(FromSeconds);
+    }
+
+    const double NewSeconds = TargetSeconds + SinceTargetSeconds;
+    MasterClock.SetSeconds(NewSeconds);
+    ElapsedTimeSeconds = NewSeconds;
+
+    // 이벤트 커서만 이분 탐색으로 이동 - 대상 시각 이후의 이벤트는 다시 대기 상태
+    EventTimeline.Seek(TargetSeconds);
+    EventScheduler.SetClock(MasterClock);
+    if (!bForwardLoopWrap)
+    {
+        EventScheduler.Seek(TargetSeconds);
+    }
+
+    ApplyTimecodeValue(FTimecodeValue::FromSeconds(NewSeconds, FrameRate, bUseDropFrameTimecode));
+
+    // 슬레이브에는 명령 하나만 전송 (틱 중이면 같은 틱의 동기 메시지와 한 데이터그램)
+    if (NetworkManager)
+    {
+        const double SecondsAgo = PlaybackRate != 0.0f ? SinceTargetSeconds / PlaybackRate : 0.0;
+        NetworkManager->SendTransportCommand(FTimecodeValue::FromSeconds(TargetSeconds, FrameRate, bUseDropFrameTimecode).ToString(),
+            FromSeconds, TargetSeconds, PlaybackRate, SecondsAgo);
+    }
+}
+
+bool UTimecodeComponent::SeekToSeconds(double Seconds)
+{
+    if (!CanControlTimeline(TEXT("Seek")))
+    {
+        return false;
+    }
+
+    if (!FMath::IsFinite(Seconds) || Seconds < 0.0)
+    {
+        UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] Invalid seek time: %f. Seek times must be >= 0"),
+            *GetOwner()->GetName(), Seconds);
+        return false;
+    }
+
+    JumpTimeline(GetCurrentTimeInSeconds(), Seconds, 0.0);
+
+    UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Seeked to %s (%.3f seconds)"),
+        *GetOwner()->GetName(), *CurrentTimecode, Seconds);
+    return true;
+}
+
+bool UTimecodeComponent::SeekToTimecode(const FString& Timecode)
+{
+    // 라벨을 정수 프레임으로 바꾼 뒤 double 초로 변환 (긴 타임코드에서도 프레임 정확)
+    const FTimecodeParseResult Parsed = FTimecodeValue::Parse(FStringView(Timecode).TrimStartAndEnd());
+    if (!Parsed.IsValid())
+    {
+        UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] Cannot seek to '%s': %s at position %d"),
+            *GetOwner()->GetName(), *Timecode, FTimecodeValue::GetParseErrorText(Parsed.Error), Parsed.Position);
+        return false;
+    }
+
+    const bool bDropFrame = bUseDropFrameTimecode || Parsed.bDropFrame;
+    return SeekToSeconds(FTimecodeValue::FromFields(Parsed.Fields, FrameRate, bDropFrame).ToSeconds());
+}
+
+bool UTimecodeComponent::SeekToFrame(int64 FrameNumber)
+{
+    const FTimecodeValue Rate = FTimecodeValue::FromFrameRate(FrameRate, bUseDropFrameTimecode);
+    return SeekToSeconds(FTimecodeValue(FrameNumber, Rate.RateNumerator, Rate.RateDenominator, Rate.bDropFrame).ToSeconds());
+}
+
+bool UTimecodeComponent::SetPlaybackRate(float NewRate)
+{
+    if (!CanControlTimeline(TEXT("Playback rate change")) || !FMath::IsFinite(NewRate))
+    {
+        return false;
+    }
+
+    // 현재 위치에서 속도만 변경 (위치 이동 없음)
+    MasterClock.SetRate(NewRate);
+    PlaybackRate = NewRate;
+    ElapsedTimeSeconds = MasterClock.GetSeconds();
+    EventScheduler.SetClock(MasterClock);
+
+    if (NetworkManager)
+    {
+        NetworkManager->SendTransportCommand(CurrentTimecode, ElapsedTimeSeconds, ElapsedTimeSeconds, PlaybackRate);
+    }
+
+    UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Playback rate set to %.2f"), *GetOwner()->GetName(), PlaybackRate);
+    return true;
+}
+
+float UTimecodeComponent::GetPlaybackRate() const
+{
+    return PlaybackRate;
+}
+
+bool UTimecodeComponent::SetLoopRange(double StartSeconds, double EndSeconds)
+{
+    if (StartSeconds < 0.0 || EndSeconds <= StartSeconds)
+    {
+        UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] Invalid loop range: %f - %f"),
+            *GetOwner()->GetName(), StartSeconds, EndSeconds);
+        return false;
+    }
+
+    bLoopEnabled = true;
+    LoopStartSeconds = StartSeconds;
+    LoopEndSeconds = EndSeconds;
+    EventScheduler.SetLoopRange(StartSeconds, EndSeconds);
+
+    UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Loop range set: %.3f - %.3f seconds"),
+        *GetOwner()->GetName(), StartSeconds, EndSeconds);
+    return true;
+}
+
+void UTimecodeComponent::ClearLoopRange()
+{
+    bLoopEnabled = false;
+    EventScheduler.ClearLoopRange();
+}
+
+bool UTimecodeComponent::IsLoopingForward() const
+{
+    return bLoopEnabled && PlaybackRate > 0.0f;
+}
+
+void UTimecodeComponent::ApplyLoopRange()
+{
+    if (!bLoopEnabled)
+    {
+        return;
+    }
+
+    // 넘어간 만큼은 반대편 끝에서 이어서 진행 (루프 주기 유지)
+    const double Length = LoopEndSeconds - LoopStartSeconds;
+    if (PlaybackRate > 0.0f && ElapsedTimeSeconds >= LoopEndSeconds)
+    {
+        JumpTimeline(LoopEndSeconds, LoopStartSeconds, FMath::Fmod(ElapsedTimeSeconds - LoopEndSeconds, Length), true);
+    }
+    else if (PlaybackRate < 0.0f && ElapsedTimeSeconds < LoopStartSeconds)
+    {
+        JumpTimeline(LoopStartSeconds, LoopEndSeconds, -FMath::Fmod(LoopStartSeconds - ElapsedTimeSeconds, Length));
+    }
+}
+
+void UTimecodeComponent::HoldAtTimelineStart()
+{
+    if (bLoopEnabled || PlaybackRate >= 0.0f || MasterClock.GetSeconds() > 0.0)
+    {
+        return;
+    }
+
+    // 역재생이 0에 도달하면 0에서 일시 정지 - 음수 구간에 머문 시간만큼 정방향 재생이 멈춰 있지 않도록
+    MasterClock.SetRate(0.0);
+    MasterClock.SetSeconds(0.0);
+    PlaybackRate = 0.0f;
+    ElapsedTimeSeconds = 0.0;
+    EventScheduler.SetClock(MasterClock);
+    ApplyTimecodeValue(FTimecodeValue::FromSeconds(0.0, FrameRate, bUseDropFrameTimecode));
+
+    // 슬레이브도 같은 위치에서 정지 (위치 이동 없는 속도 명령)
+    if (NetworkManager)
+    {
+        NetworkManager->SendTransportCommand(CurrentTimecode, 0.0, 0.0, PlaybackRate);
+    }
+
+    UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Reverse playback reached 00:00:00:00, paused"), *GetOwner()->GetName());
+}
+
 void UTimecodeComponent::RegisterTimecodeEvent(const FString& EventName, float EventTimeInSeconds)
 {
     if (EventTimeInSeconds >= 0.0f)
     {
-        TimecodeEvents.Add(EventName, EventTimeInSeconds);
+        EventTimeline.Add(EventName, EventTimeInSeconds);
+        EventScheduler.AddEvent(EventName, EventTimeInSeconds);
         UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Timecode event registered: %s at %f seconds"),
             *GetOwner()->GetName(), *EventName, EventTimeInSeconds);
     }
@@ -268,9 +538,9 @@ void UTimecodeComponent::RegisterTimecodeEvent(const FString& EventName, float E
 
 void UTimecodeComponent::UnregisterTimecodeEvent(const FString& EventName)
 {
-    if (TimecodeEvents.Remove(EventName) > 0)
+    EventScheduler.RemoveEvent(EventName);
+    if (EventTimeline.Remove(EventName))
     {
-        TriggeredEvents.Remove(EventName);
         UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Timecode event unregistered: %s"),
             *GetOwner()->GetName(), *EventName);
     }
@@ -283,9 +553,9 @@ void UTimecodeComponent::UnregisterTimecodeEvent(const FString& EventName)
 
 void UTimecodeComponent::ClearAllTimecodeEvents()
 {
-    int32 EventCount = TimecodeEvents.Num();
-    TimecodeEvents.Empty();
-    TriggeredEvents.Empty();
+    int32 EventCount = EventTimeline.Num();
+    EventTimeline.Empty();
+    EventScheduler.Empty();
 
     UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Cleared %d timecode events"),
         *GetOwner()->GetName(), EventCount);
@@ -293,13 +563,58 @@ void UTimecodeComponent::ClearAllTimecodeEvents()
 
 void UTimecodeComponent::ResetEventTriggers()
 {
-    int32 TriggerCount = TriggeredEvents.Num();
-    TriggeredEvents.Empty();
+    int32 TriggerCount = EventTimeline.GetTriggeredCount();
+    EventTimeline.ResetTriggers();
+    EventScheduler.ResetTriggers();
 
     UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Reset %d event triggers"),
         *GetOwner()->GetName(), TriggerCount);
 }
 
+void UTimecodeComponent::SetDispatchEventsOnWorkerThread(bool bEnable)
+{
+    if (bEnable == bDispatchEventsOnWorkerThread)
+    {
+        return;
+    }
+
+    bDispatchEventsOnWorkerThread = bEnable;
+    if (bEnable)
+    {
+        // 스레드 시작 전에 시간축과 프레임 레이트를 맞춤 (지나간 이벤트는 다시 발생하지 않도록 현재 시각으로 이동)
+        SyncEventSchedulerFrameRate();
+        EventScheduler.SetClock(MasterClock);
+        EventScheduler.Seek(GetCurrentTimeInSeconds());
+        if (!EventScheduler.StartThread())
+        {
+            bDispatchEventsOnWorkerThread = false;
+            UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] Failed to start event scheduler thread"),
+                *GetOwner()->GetName());
+            return;
+        }
+    }
+    else
+    {
+        EventScheduler.Shutdown();
+    }
+
+    UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Worker thread event dispatch %s"),
+        *GetOwner()->GetName(), bEnable ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void UTimecodeComponent::SyncEventSchedulerFrameRate()
+{
+    // 바뀐 경우에만 스케줄러 잠금을 잡음
+    if (SchedulerFrameRate == FrameRate && bSchedulerDropFrame == bUseDropFrameTimecode)
+    {
+        return;
+    }
+
+    SchedulerFrameRate = FrameRate;
+    bSchedulerDropFrame = bUseDropFrameTimecode;
+    EventScheduler.SetFrameRate(FrameRate, bUseDropFrameTimecode);
+}
+
 ENetworkConnectionState UTimecodeComponent::GetNetworkConnectionState() const
 {
     return ConnectionState;
@@ -355,6 +670,8 @@ bool UTimecodeComponent::SetupNetwork()
     NetworkManager->OnMessageReceived.AddDynamic(this, &UTimecodeComponent::OnTimecodeMessageReceived);
     NetworkManager->OnNetworkStateChanged.AddDynamic(this, &UTimecodeComponent::OnNetworkStateChanged);
     NetworkManager->OnRoleModeChanged.AddDynamic(this, &UTimecodeComponent::OnNetworkRoleModeChanged);
+    NetworkManager->OnElectedRoleChanged.AddDynamic(this, &UTimecodeComponent::OnNetworkElectedRoleChanged);
+    NetworkManager->OnTransportCommandReceived.AddDynamic(this, &UTimecodeComponent::OnNetworkTransportCommand);
 
     // Initialize network
     bool bSuccess = NetworkManager->Initialize(bIsMaster, UDPPort);
@@ -364,6 +681,8 @@ bool UTimecodeComponent::SetupNetwork()
         NetworkManager->OnMessageReceived.RemoveAll(this);
         NetworkManager->OnNetworkStateChanged.RemoveAll(this);
         NetworkManager->OnRoleModeChanged.RemoveAll(this);
+        NetworkManager->OnElectedRoleChanged.RemoveAll(this);
+        NetworkManager->OnTransportCommandReceived.RemoveAll(this);
         NetworkManager = nullptr;
 
         UE_LOG(LogTimecodeComponent, Error, TEXT("[%s] Failed to initialize network manager"),
@@ -374,6 +693,9 @@ bool UTimecodeComponent::SetupNetwork()
     // Set target port
     NetworkManager->SetTargetPort(TargetPortNumber);
 
+    // Frame rate carried in outgoing messages
+    NetworkManager->SetFrameRate(FrameRate);
+
     // Join multicast group
     if (!MulticastGroup.IsEmpty())
     {
@@ -543,28 +865,12 @@ bool UTimecodeComponent::GetIsMaster() const
 
 void UTimecodeComponent::UpdateTimecode(float DeltaTime)
 {
-    // Update elapsed time
-    ElapsedTimeSeconds += DeltaTime;
+    // Sample the master clock (DeltaTime is not integrated)
+    ElapsedTimeSeconds = MasterClock.GetSeconds();
 
-    // Generate timecode using SMPTE converter module
-    FString NewTimecode;
-
-    if (SMPTEConverter)
+    // Trigger event if the frame changed (the string is only built then)
+    if (ApplyTimecodeValue(FTimecodeValue::FromSeconds(ElapsedTimeSeconds, FrameRate, bUseDropFrameTimecode)))
     {
-        NewTimecode = SMPTEConverter->SecondsToTimecode(ElapsedTimeSeconds, FrameRate, bUseDropFrameTimecode);
-    }
-    else
-    {
-        // Fallback to direct function call
-        NewTimecode = UTimecodeUtils::SecondsToTimecode(ElapsedTimeSeconds, FrameRate, bUseDropFrameTimecode);
-    }
-
-    // Trigger event if timecode changed
-    if (NewTimecode != CurrentTimecode)
-    {
-        CurrentTimecode = NewTimecode;
-        OnTimecodeChanged.Broadcast(CurrentTimecode);
-
         UE_LOG(LogTimecodeComponent, Verbose, TEXT("[%s] Timecode updated: %s"),
             *GetOwner()->GetName(), *CurrentTimecode);
     }
@@ -572,30 +878,53 @@ void UTimecodeComponent::UpdateTimecode(float DeltaTime)
 
 void UTimecodeComponent::CheckTimecodeEvents()
 {
-    // Check all registered events
-    for (const auto& Event : TimecodeEvents)
+    // 역재생: 지나온 이벤트를 발생시키지 않고 다시 대기 상태로 (정방향으로 지나갈 때 다시 발생)
+    if (PlaybackRate < 0.0f)
     {
-        const FString& EventName = Event.Key;
-        float EventTime = Event.Value;
-
-        // Check if event is not triggered and current time has passed event time
-        if (!TriggeredEvents.Contains(EventName) && ElapsedTimeSeconds >= EventTime)
+        EventTimeline.Rewind(ElapsedTimeSeconds);
+        if (EventScheduler.IsThreadRunning())
         {
-            // Trigger event
-            OnTimecodeEventTriggered.Broadcast(EventName, EventTime);
+            EventScheduler.Rewind(ElapsedTimeSeconds);
+        }
+        return;
+    }
 
-            // Mark as triggered
-            TriggeredEvents.Add(EventName);
+    DispatchEventsUpTo(ElapsedTimeSeconds);
+}
 
-            // Broadcast event over network (master mode only)
-            if (bIsMaster && NetworkManager)
-            {
-                NetworkManager->SendEventMessage(EventName, CurrentTimecode);
-            }
+void UTimecodeComponent::DispatchEventsUpTo(double Time)
+{
+    // 실제 디스패치 시각 (틱 시각보다 늦을 수 있음) - 지연 보고용
+    const double FiredSeconds = GetCurrentTimeInSeconds();
+
+    const auto Fire = [this, FiredSeconds](const FTimecodeTimelineEvent& Event)
+    {
+        // Trigger event
+        OnTimecodeEventTriggered.Broadcast(Event.Name, static_cast<float>(Event.Time));
+        if (OnTimecodeEventFired.IsBound())
+        {
+            OnTimecodeEventFired.Broadcast(FTimecodeEventFireInfo::Make(Event, FiredSeconds, FrameRate, bUseDropFrameTimecode, false));
+        }
 
-            UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Timecode event triggered: %s at time %s"),
-                *GetOwner()->GetName(), *EventName, *CurrentTimecode);
+        // Broadcast event over network (master mode only)
+        if (bIsMaster && NetworkManager)
+        {
+            NetworkManager->SendEventMessage(Event.Name, CurrentTimecode);
         }
+
+        UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Timecode event triggered: %s at time %s"),
+            *GetOwner()->GetName(), *Event.Name, *CurrentTimecode);
+    };
+
+    // Only the events between the cursor and the current time are examined
+    if (IsLoopingForward() && Time >= LoopEndSeconds)
+    {
+        // 루프 끝 이후의 이벤트는 루프 안에서 발생하지 않음 (슬레이브는 되감기 명령이 오기 전까지 끝을 넘어갈 수 있음)
+        EventTimeline.AdvanceBefore(LoopEndSeconds, Fire);
+    }
+    else
+    {
+        EventTimeline.Advance(Time, Fire);
     }
 }
 
@@ -736,6 +1065,50 @@ void UTimecodeComponent::OnNetworkRoleModeChanged(ETimecodeRoleMode NewMode)
     }
 }
 
+void UTimecodeComponent::OnNetworkTransportCommand(double PreviousSeconds, double TimecodeSeconds, float InPlaybackRate)
+{
+    if (bIsMaster)
+    {
+        return;
+    }
+
+    // 마스터와 같은 규칙: 떠나는 위치까지의 이벤트를 발생시키고 이벤트 커서만 이동 (전체 초기화 없음)
+    // 타임코드 위치와 속도는 수신 스레드가 서보 출력에 이미 반영함
+    if (PlaybackRate > 0.0f)
+    {
+        DispatchEventsUpTo(PreviousSeconds);
+    }
+    if (TimecodeSeconds != PreviousSeconds)
+    {
+        EventTimeline.Seek(TimecodeSeconds);
+
+        // 로컬 루프 구간과 같은 정방향 되감기는 스케줄러 스레드가 이미 처리함
+        const bool bForwardLoopWrap = IsLoopingForward() && InPlaybackRate > 0.0f &&
+            PreviousSeconds == LoopEndSeconds && TimecodeSeconds == LoopStartSeconds;
+        if (!bForwardLoopWrap)
+        {
+            EventScheduler.Seek(TimecodeSeconds);
+        }
+    }
+
+    // 승격되어도 같은 속도로 이어가도록 마스터 클럭에도 반영
+    PlaybackRate = InPlaybackRate;
+    MasterClock.SetRate(InPlaybackRate);
+
+    UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Transport from master: %.3fs -> %.3fs at rate %.2f"),
+        *GetOwner()->GetName(), PreviousSeconds, TimecodeSeconds, InPlaybackRate);
+}
+
+void UTimecodeComponent::OnNetworkElectedRoleChanged(bool bNewIsMaster)
+{
+    // 선출로 역할이 바뀌면 경과 시간은 그대로 이어서 마스터/슬레이브 동작만 전환
+    if (bIsMaster != bNewIsMaster)
+    {
+        UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] Role changed by master election"), *GetOwner()->GetName());
+        OnRoleStateChanged(bNewIsMaster);
+    }
+}
+
 void UTimecodeComponent::LogDebugInfo()
 {
     // Basic component info
@@ -780,8 +1153,8 @@ void UTimecodeComponent::LogDebugInfo()
         TEXT("Disconnected"));
 
     // Event info
-    UE_LOG(LogTimecodeComponent, Display, TEXT("Registered Events: %d"), TimecodeEvents.Num());
-    UE_LOG(LogTimecodeComponent, Display, TEXT("Triggered Events: %d"), TriggeredEvents.Num());
+    UE_LOG(LogTimecodeComponent, Display, TEXT("Registered Events: %d"), EventTimeline.Num());
+    UE_LOG(LogTimecodeComponent, Display, TEXT("Triggered Events: %d"), EventTimeline.GetTriggeredCount());
 
     // Network manager status
     if (NetworkManager)
@@ -789,6 +1162,11 @@ void UTimecodeComponent::LogDebugInfo()
         UE_LOG(LogTimecodeComponent, Display, TEXT("Network Manager: Valid"));
         UE_LOG(LogTimecodeComponent, Display, TEXT("Network Manager Connection: %s"),
             NetworkManager->HasReceivedValidMessage() ? TEXT("Active") : TEXT("Inactive"));
+
+        const FTimecodeHoldoverStatus Holdover = NetworkManager->GetHoldoverStatus();
+        UE_LOG(LogTimecodeComponent, Display, TEXT("Sync State: %s, Holdover: %.2fs, Uncertainty: %.3fms, Slew Remaining: %.3fms"),
+            *UEnum::GetValueAsString(Holdover.State), Holdover.HoldoverDuration,
+            Holdover.Uncertainty * 1000.0, Holdover.SlewRemaining * 1000.0);
     }
     else
     {
@@ -834,9 +1212,13 @@ void UTimecodeComponent::LogDebugInfo()
     {
         double Phase, Frequency, Offset;
         NetworkManager->GetPLLStatus(Phase, Frequency, Offset);
+        const FTimecodeClockFilterStats FilterStats = NetworkManager->GetClockFilterStats();
 
         UE_LOG(LogTimecodeComponent, Display, TEXT("PLL Status - Frequency: %.6f, Offset: %.3fms"),
             Frequency, Offset * 1000.0);
+        UE_LOG(LogTimecodeComponent, Display, TEXT("Clock Filter - Samples: %d, Delay: %.3fms (min %.3f, max %.3f), Jitter: %.3fms"),
+            FilterStats.SampleCount, FilterStats.SelectedDelay * 1000.0, FilterStats.MinDelay * 1000.0,
+            FilterStats.MaxDelay * 1000.0, FilterStats.Jitter * 1000.0);
     }
 
     UE_LOG(LogTimecodeComponent, Display, TEXT("========================================="));
@@ -897,13 +1279,14 @@ void UTimecodeComponent::ApplyTimecodeMode()
         bUsePLL = false;
         bUseDropFrameTimecode = true;
 
-        // SMPTE 모드에서는 정확한 프레임 레이트 확인
-        if (!FMath::IsNearlyEqual(FrameRate, 29.97f, 0.01f) &&
-            !FMath::IsNearlyEqual(FrameRate, 59.94f, 0.01f) &&
-            bUseDropFrameTimecode)
+        // SMPTE 모드에서는 정확한 프레임 레이트 확인 (드롭 프레임은 NTSC 레이트에서만 유효)
         {
-            UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] Drop frame is only applicable to 29.97fps or 59.94fps! Current: %.2ffps"),
-                *GetOwner()->GetName(), FrameRate);
+            const FTimecodeValue Rate = FTimecodeValue::FromFrameRate(FrameRate, false);
+            if (bUseDropFrameTimecode && !FTimecodeValue::SupportsDropFrame(Rate.RateNumerator, Rate.RateDenominator))
+            {
+                UE_LOG(LogTimecodeComponent, Warning, TEXT("[%s] Drop frame is only applicable to 29.97fps, 59.94fps or 119.88fps! Current: %.2ffps"),
+                    *GetOwner()->GetName(), FrameRate);
+            }
         }
 
         UE_LOG(LogTimecodeComponent, Log, TEXT("[%s] SMPTE Only mode applied: PLL disabled, Drop Frame enabled"),
@@ -953,6 +1336,9 @@ void UTimecodeComponent::ApplyTimecodeMode()
         }
     }
 
+    // 스케줄러 스레드가 보고하는 타임코드 라벨도 새 드롭 프레임 설정을 따름
+    SyncEventSchedulerFrameRate();
+
     // 모드 변경 이벤트 발생 (이미 타임코드 컴포넌트에 구현됨)
     if (PreviousMode != TimecodeMode)
     {
@@ -1073,22 +1459,11 @@ bool UTimecodeComponent::GetIsDedicatedMaster() const
 
 void UTimecodeComponent::UpdateRawTimecode(float DeltaTime)
 {
-    // Raw 모드: 단순히 경과 시간을 증가시키고 기본 형식의 타임코드 생성
-    ElapsedTimeSeconds += DeltaTime;
-
-    // 기본 형식의 타임코드 생성 (HH:MM:SS:FF)
-    int32 Hours = FMath::FloorToInt(ElapsedTimeSeconds / 3600.0f);
-    int32 Minutes = FMath::FloorToInt(FMath::Fmod(ElapsedTimeSeconds / 60.0f, 60.0f));
-    int32 Seconds = FMath::FloorToInt(FMath::Fmod(ElapsedTimeSeconds, 60.0f));
-    int32 Frames = FMath::FloorToInt(FMath::Fmod(ElapsedTimeSeconds * FrameRate, FrameRate));
+    // Raw 모드: 마스터 클럭에서 경과 시간을 읽고 기본 형식의 타임코드 생성 (HH:MM:SS:FF)
+    ElapsedTimeSeconds = MasterClock.GetSeconds();
 
-    FString NewTimecode = FString::Printf(TEXT("%02d:%02d:%02d:%02d"), Hours, Minutes, Seconds, Frames);
-
-    if (NewTimecode != CurrentTimecode)
+    if (ApplyTimecodeValue(FTimecodeValue::FromSeconds(ElapsedTimeSeconds, FrameRate, false)))
     {
-        CurrentTimecode = NewTimecode;
-        OnTimecodeChanged.Broadcast(CurrentTimecode);
-
         UE_LOG(LogTimecodeComponent, Verbose, TEXT("[%s] Raw timecode updated: %s"),
             *GetOwner()->GetName(), *CurrentTimecode);
     }
@@ -1110,24 +1485,15 @@ void UTimecodeComponent::UpdatePLLTimecode(float DeltaTime)
     }
 
     // 시간 업데이트
-    ElapsedTimeSeconds += DeltaTime;
+    ElapsedTimeSeconds = MasterClock.GetSeconds();
 
     // PLL 처리를 통한 시간 미세 조정 (마스터 모드에서도 자체 안정화를 위해 PLL 적용)
-    float AdjustedTime = PLLSynchronizer->ProcessTime(ElapsedTimeSeconds, ElapsedTimeSeconds, DeltaTime);
+    // PLL은 float 연산이므로 절대 시각 대신 위상 보정량만 받아 double 시각에 더함
+    const double AdjustedTime = ElapsedTimeSeconds + PLLSynchronizer->ProcessTime(0.0f, 0.0f, DeltaTime);
 
-    // 기본 타임코드 형식 생성
-    int32 Hours = FMath::FloorToInt(AdjustedTime / 3600.0f);
-    int32 Minutes = FMath::FloorToInt(FMath::Fmod(AdjustedTime / 60.0f, 60.0f));
-    int32 Seconds = FMath::FloorToInt(FMath::Fmod(AdjustedTime, 60.0f));
-    int32 Frames = FMath::FloorToInt(FMath::Fmod(AdjustedTime * FrameRate, FrameRate));
-
-    FString NewTimecode = FString::Printf(TEXT("%02d:%02d:%02d:%02d"), Hours, Minutes, Seconds, Frames);
-
-    if (NewTimecode != CurrentTimecode)
+    if (ApplyTimecodeValue(FTimecodeValue::FromSeconds(AdjustedTime, FrameRate, false)))
     {
-        CurrentTimecode = NewTimecode;
         ElapsedTimeSeconds = AdjustedTime; // 조정된 시간으로 업데이트
-        OnTimecodeChanged.Broadcast(CurrentTimecode);
 
         UE_LOG(LogTimecodeComponent, Verbose, TEXT("[%s] PLL timecode updated: %s"),
             *GetOwner()->GetName(), *CurrentTimecode);
@@ -1139,25 +1505,10 @@ void UTimecodeComponent::UpdateSMPTETimecode(float DeltaTime)
     // SMPTE 모드: SMPTE 타임코드 변환 (드롭 프레임 적용)
 
     // 시간 업데이트
-    ElapsedTimeSeconds += DeltaTime;
-
-    // SMPTE 컨버터 적용
-    FString NewTimecode;
-    if (SMPTEConverter)
-    {
-        NewTimecode = SMPTEConverter->SecondsToTimecode(ElapsedTimeSeconds, FrameRate, true);
-    }
-    else
-    {
-        // 컨버터가 없으면 유틸리티 함수 사용
-        NewTimecode = UTimecodeUtils::SecondsToTimecode(ElapsedTimeSeconds, FrameRate, true);
-    }
+    ElapsedTimeSeconds = MasterClock.GetSeconds();
 
-    if (NewTimecode != CurrentTimecode)
+    if (ApplyTimecodeValue(FTimecodeValue::FromSeconds(ElapsedTimeSeconds, FrameRate, true)))
     {
-        CurrentTimecode = NewTimecode;
-        OnTimecodeChanged.Broadcast(CurrentTimecode);
-
         UE_LOG(LogTimecodeComponent, Verbose, TEXT("[%s] SMPTE timecode updated: %s"),
             *GetOwner()->GetName(), *CurrentTimecode);
     }
@@ -1179,30 +1530,30 @@ void UTimecodeComponent::UpdateIntegratedTimecode(float DeltaTime)
     }
 
     // 시간 업데이트
-    ElapsedTimeSeconds += DeltaTime;
+    ElapsedTimeSeconds = MasterClock.GetSeconds();
 
-    // PLL 처리를 통한 시간 미세 조정
-    float AdjustedTime = PLLSynchronizer->ProcessTime(ElapsedTimeSeconds, ElapsedTimeSeconds, DeltaTime);
+    // PLL 처리를 통한 시간 미세 조정 (위상 보정량만 float로 계산)
+    const double AdjustedTime = ElapsedTimeSeconds + PLLSynchronizer->ProcessTime(0.0f, 0.0f, DeltaTime);
 
-    // SMPTE 컨버터로 타임코드 생성
-    FString NewTimecode;
-    if (SMPTEConverter)
+    if (ApplyTimecodeValue(FTimecodeValue::FromSeconds(AdjustedTime, FrameRate, true)))
     {
-        NewTimecode = SMPTEConverter->SecondsToTimecode(AdjustedTime, FrameRate, true);
-    }
-    else
-    {
-        // 컨버터가 없으면 유틸리티 함수 사용
-        NewTimecode = UTimecodeUtils::SecondsToTimecode(AdjustedTime, FrameRate, true);
-    }
-
-    if (NewTimecode != CurrentTimecode)
-    {
-        CurrentTimecode = NewTimecode;
         ElapsedTimeSeconds = AdjustedTime; // 조정된 시간으로 업데이트
-        OnTimecodeChanged.Broadcast(CurrentTimecode);
 
         UE_LOG(LogTimecodeComponent, Verbose, TEXT("[%s] Integrated timecode updated: %s"),
             *GetOwner()->GetName(), *CurrentTimecode);
     }
-}
\ No newline at end of file
+}
+
+bool UTimecodeComponent::ApplyTimecodeValue(const FTimecodeValue& NewValue)
+{
+    // 프레임이 바뀐 경우에만 문자열을 만들고 변경 이벤트 발생
+    if (NewValue == CurrentTimecodeValue)
+    {
+        return false;
+    }
+
+    CurrentTimecodeValue = NewValue;
+    CurrentTimecode = NewValue.ToString();
+    OnTimecodeChanged.Broadcast(CurrentTimecode);
+    return true;
+}
@@ -0,0 +1,280 @@
+﻿#include "TimecodeEventScheduler.h"
+#include "TimecodeValue.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
+
+FTimecodeEventFireInfo FTimecodeEventFireInfo::Make(const FTimecodeTimelineEvent& Event, double InFiredSeconds, float FrameRate, bool bDropFrame, bool bInFromWorkerThread)
+{
+    FTimecodeEventFireInfo Info;
+    Info.EventName = Event.Name;
+    Info.ScheduledSeconds = Event.Time;
+    Info.ScheduledTimecode = FTimecodeValue::FromSeconds(Event.Time, FrameRate, bDropFrame).ToString();
+    Info.FiredSeconds = InFiredSeconds;
+    Info.LatenessSeconds = InFiredSeconds - Event.Time;
+    Info.bFromWorkerThread = bInFromWorkerThread;
+    return Info;
+}
+
+FTimecodeEventScheduler::FTimecodeEventScheduler()
+    : FrameRate(30.0f)
+    , bDropFrame(false)
+    , bLoopEnabled(false)
+    , LoopStart(0.0)
+    , LoopEnd(0.0)
+    , LoopShift(0.0)
+    , Thread(nullptr)
+    , WakeEvent(nullptr)
+    , bStopping(false)
+{
+}
+
+FTimecodeEventScheduler::~FTimecodeEventScheduler()
+{
+    Shutdown();
+}
+
+bool FTimecodeEventScheduler::StartThread()
+{
+    if (Thread != nullptr)
+    {
+        return false;
+    }
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    bStopping = false;
+    Thread = FRunnableThread::Create(this, TEXT("TimecodeEventScheduler"), 0, TPri_AboveNormal);
+    if (Thread == nullptr)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void FTimecodeEventScheduler::Shutdown()
+{
+    if (Thread != nullptr)
+    {
+        // Kill calls Stop, which wakes the thread
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (WakeEvent != nullptr)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+}
+
+void FTimecodeEventScheduler::SetClock(const FTimecodeMasterClock& InClock)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        const bool bWasLooping = IsLooping();
+        const double Previous = GetLoopSeconds();
+        Clock = InClock;
+
+        // Around a loop end the owner may be a pass behind this thread (not wrapped yet) or ahead of it
+        // (wrapped first); keep the timeline continuous and let DispatchDue make a wrap that is still due
+        const double Now = Clock.GetSeconds();
+        const bool bWrapOutstanding = LoopShift > 0.0 ? Now >= LoopEnd : Previous >= LoopEnd && Now < LoopEnd;
+        if (bWasLooping && IsLooping() && bWrapOutstanding)
+        {
+            const double Length = LoopEnd - LoopStart;
+            LoopShift = FMath::RoundToDouble((Now - Previous) / Length) * Length;
+        }
+        else
+        {
+            LoopShift = 0.0;
+        }
+    }
+    Wake();
+}
+
+void FTimecodeEventScheduler::SetFrameRate(float InFrameRate, bool bInDropFrame)
+{
+    FScopeLock ScopeLock(&Lock);
+    FrameRate = InFrameRate;
+    bDropFrame = bInDropFrame;
+}
+
+void FTimecodeEventScheduler::SetLoopRange(double InLoopStart, double InLoopEnd)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        bLoopEnabled = InLoopEnd > InLoopStart;
+        LoopStart = InLoopStart;
+        LoopEnd = InLoopEnd;
+        LoopShift = 0.0;
+    }
+    Wake();
+}
+
+void FTimecodeEventScheduler::ClearLoopRange()
+{
+    FScopeLock ScopeLock(&Lock);
+    bLoopEnabled = false;
+    LoopShift = 0.0;
+}
+
+void FTimecodeEventScheduler::AddEvent(const FString& Name, double Time)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        Timeline.Add(Name, Time);
+    }
+    Wake();
+}
+
+void FTimecodeEventScheduler::RemoveEvent(const FString& Name)
+{
+    FScopeLock ScopeLock(&Lock);
+    Timeline.Remove(Name);
+}
+
+void FTimecodeEventScheduler::Empty()
+{
+    FScopeLock ScopeLock(&Lock);
+    Timeline.Empty();
+}
+
+void FTimecodeEventScheduler::Seek(double Time)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        Timeline.Seek(Time);
+
+        // A seek follows SetClock with the target time, so no wrap is outstanding
+        LoopShift = 0.0;
+    }
+    Wake();
+}
+
+void FTimecodeEventScheduler::ResetTriggers()
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        Timeline.ResetTriggers();
+    }
+    Wake();
+}
+
+void FTimecodeEventScheduler::Rewind(double Time)
+{
+    FScopeLock ScopeLock(&Lock);
+    Timeline.Rewind(Time);
+}
+
+int32 FTimecodeEventScheduler::DispatchDue()
+{
+    // Collect under the lock, call out without it so callbacks may register events
+    TArray<FTimecodeEventFireInfo, TInlineAllocator<4>> Due;
+    {
+        FScopeLock ScopeLock(&Lock);
+        double Now = GetLoopSeconds();
+        const auto Collect = [this, &Now, &Due](const FTimecodeTimelineEvent& Event)
+        {
+            Due.Add(FTimecodeEventFireInfo::Make(Event, Now, FrameRate, bDropFrame, true));
+        };
+
+        if (IsLooping() && Now >= LoopEnd)
+        {
+            // Finish the pass (events at the loop end belong to the next pass's start), then wrap
+            Timeline.AdvanceBefore(LoopEnd, Collect);
+
+            const double Length = LoopEnd - LoopStart;
+            const double Passes = FMath::FloorToDouble((Now - LoopEnd) / Length) + 1.0;
+            LoopShift += Passes * Length;
+            Now -= Passes * Length;
+            Timeline.Seek(LoopStart);
+        }
+
+        Timeline.Advance(Now, Collect);
+    }
+
+    for (const FTimecodeEventFireInfo& Info : Due)
+    {
+        EventDispatched.Broadcast(Info);
+    }
+    return Due.Num();
+}
+
+bool FTimecodeEventScheduler::IsLooping() const
+{
+    return bLoopEnabled && Clock.GetRate() > 0.0;
+}
+
+double FTimecodeEventScheduler::GetLoopSeconds() const
+{
+    return Clock.GetSeconds() - LoopShift;
+}
+
+void FTimecodeEventScheduler::Wake()
+{
+    if (WakeEvent != nullptr)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FTimecodeEventScheduler::Stop()
+{
+    bStopping = true;
+    Wake();
+}
+
+uint32 FTimecodeEventScheduler::Run()
+{
+    while (!bStopping)
+    {
+        bool bPending = false;
+        double Wait = 0.0;
+        {
+            FScopeLock ScopeLock(&Lock);
+            double NextTime = 0.0;
+            bool bHasNext = Timeline.GetNextEventTime(NextTime);
+
+            // The loop end is due like an event, so the wrap is not late; it is due even when every
+            // cue of the pass has fired, otherwise the cursor never returns to the loop start
+            if (IsLooping())
+            {
+                NextTime = bHasNext ? FMath::Min(NextTime, LoopEnd) : LoopEnd;
+                bHasNext = true;
+            }
+
+            bPending = Clock.IsRunning() && Clock.GetRate() > 0.0 && bHasNext;
+            if (bPending)
+            {
+                // Timeline seconds to real seconds
+                Wait = (NextTime - GetLoopSeconds()) / Clock.GetRate();
+            }
+        }
+
+        if (!bPending)
+        {
+            // Stopped, paused or reversed clock, or nothing pending
+            WakeEvent->Wait(MaxWaitMs);
+        }
+        else if (Wait > SpinWindow)
+        {
+            // Sleep until just before the event; a new event, seek or clock change wakes us early
+            const uint32 WaitMs = static_cast<uint32>(FMath::Min((Wait - SpinWindow) * 1000.0, static_cast<double>(MaxWaitMs)));
+            WakeEvent->Wait(FMath::Max(WaitMs, 1u));
+        }
+        else if (Wait > 0.0)
+        {
+            FPlatformProcess::YieldThread();
+        }
+        else
+        {
+            DispatchDue();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+﻿#include "TimecodeEventTimeline.h"
+#include "Algo/BinarySearch.h"
+
+FTimecodeEventTimeline::FTimecodeEventTimeline()
+    : Cursor(0)
+{
+}
+
+bool FTimecodeEventTimeline::Add(const FString& Name, double Time)
+{
+    const bool bReplaced = Remove(Name);
+
+    // After events with the same time, so ties keep registration order
+    const int32 Index = UpperBound(Time);
+    FTimecodeTimelineEvent& Event = Events.InsertDefaulted_GetRef(Index);
+    Event.Time = Time;
+    Event.Name = Name;
+    EventTimes.Add(Name, Time);
+
+    if (Index < Cursor)
+    {
+        ++Cursor;
+        LateEvents.Add(Name);
+    }
+    return bReplaced;
+}
+
+bool FTimecodeEventTimeline::Remove(const FString& Name)
+{
+    const double* Time = EventTimes.Find(Name);
+    if (!Time)
+    {
+        return false;
+    }
+
+    const int32 Index = FindIndex(Name, *Time);
+    if (Index != INDEX_NONE)
+    {
+        Events.RemoveAt(Index);
+        if (Index < Cursor)
+        {
+            --Cursor;
+        }
+    }
+    EventTimes.Remove(Name);
+    LateEvents.RemoveSingle(Name);
+    return true;
+}
+
+void FTimecodeEventTimeline::Empty()
+{
+    Events.Empty();
+    EventTimes.Empty();
+    LateEvents.Empty();
+    Cursor = 0;
+}
+
+void FTimecodeEventTimeline::Seek(double Time)
+{
+    Cursor = LowerBound(Time);
+    LateEvents.Reset();
+}
+
+void FTimecodeEventTimeline::ResetTriggers()
+{
+    Cursor = 0;
+    LateEvents.Reset();
+}
+
+void FTimecodeEventTimeline::Rewind(double Time)
+{
+    while (Cursor > 0 && Events[Cursor - 1].Time >= Time)
+    {
+        --Cursor;
+
+        // Now pending in order again
+        if (LateEvents.Num() > 0)
+        {
+            LateEvents.RemoveSingle(Events[Cursor].Name);
+        }
+    }
+}
+
+bool FTimecodeEventTimeline::GetNextEventTime(double& OutTime) const
+{
+    bool bFound = false;
+    if (Cursor < Events.Num())
+    {
+        OutTime = Events[Cursor].Time;
+        bFound = true;
+    }
+    for (const FString& Name : LateEvents)
+    {
+        const double Time = EventTimes.FindChecked(Name);
+        if (!bFound || Time < OutTime)
+        {
+            OutTime = Time;
+            bFound = true;
+        }
+    }
+    return bFound;
+}
+
+int32 FTimecodeEventTimeline::LowerBound(double Time) const
+{
+    return Algo::LowerBoundBy(Events, Time, &FTimecodeTimelineEvent::Time);
+}
+
+int32 FTimecodeEventTimeline::UpperBound(double Time) const
+{
+    return Algo::UpperBoundBy(Events, Time, &FTimecodeTimelineEvent::Time);
+}
+
+int32 FTimecodeEventTimeline::FindIndex(const FString& Name, double Time) const
+{
+    for (int32 Index = LowerBound(Time); Index < Events.Num() && Events[Index].Time == Time; ++Index)
+    {
+        if (Events[Index].Name == Name)
+        {
+            return Index;
+        }
+    }
+    return INDEX_NONE;
+}
@@ -0,0 +1,58 @@
+﻿#include "TimecodeMasterClock.h"
+#include "HAL/PlatformTime.h"
+
+FTimecodeMasterClock::FTimecodeMasterClock()
+    : BaseSeconds(0.0)
+    , AnchorCycles(0)
+    , Rate(1.0)
+    , bRunning(false)
+{
+}
+
+void FTimecodeMasterClock::Start()
+{
+    if (!bRunning)
+    {
+        AnchorCycles = FPlatformTime::Cycles64();
+        bRunning = true;
+    }
+}
+
+void FTimecodeMasterClock::Stop()
+{
+    if (bRunning)
+    {
+        BaseSeconds = GetSeconds();
+        bRunning = false;
+    }
+}
+
+void FTimecodeMasterClock::SetSeconds(double Seconds)
+{
+    BaseSeconds = Seconds;
+    AnchorCycles = FPlatformTime::Cycles64();
+}
+
+void FTimecodeMasterClock::SetRate(double InRate)
+{
+    // Re-anchor so the value is continuous across the change
+    BaseSeconds = GetSeconds();
+    AnchorCycles = FPlatformTime::Cycles64();
+    Rate = InRate;
+}
+
+double FTimecodeMasterClock::GetSeconds() const
+{
+    return GetSecondsAt(FPlatformTime::Cycles64());
+}
+
+double FTimecodeMasterClock::GetSecondsAt(uint64 Cycles) const
+{
+    if (!bRunning || Cycles <= AnchorCycles)
+    {
+        return BaseSeconds;
+    }
+
+    // Cycle difference stays an integer until the final scale, so precision does not depend on uptime
+    return BaseSeconds + static_cast<double>(Cycles - AnchorCycles) * FPlatformTime::GetSecondsPerCycle64() * Rate;
+}
@@ -7,7 +7,13 @@
 #include "IPAddress.h"
 #include "Misc/Guid.h"
 #include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
 #include "Serialization/ArrayReader.h"
+#include "TimecodeSettings.h"
+
+#if PLATFORM_LINUX
+#include "Linux/TimecodeLinuxSocket.h"
+#endif
 
 // Define log category
 DEFINE_LOG_CATEGORY_STATIC(LogTimecodeNetwork, Log, All);
@@ -15,8 +21,10 @@ DEFINE_LOG_CATEGORY_STATIC(LogTimecodeNetwork, Log, All);
 UTimecodeNetworkManager::UTimecodeNetworkManager()
     : Socket(nullptr)
     , Receiver(nullptr)
+    , NativeSocket(nullptr)
     , ConnectionState(ENetworkConnectionState::Disconnected)
     , InstanceID(FGuid::NewGuid().ToString())
+    , InstanceNumericID(0)
     , ReceivePortNumber(10000)
     , TargetIPAddress(TEXT("127.0.0.1"))
     , MulticastGroupAddress(TEXT("239.0.0.1"))
@@ -39,6 +47,57 @@ UTimecodeNetworkManager::UTimecodeNetworkManager()
     , bIsShuttingDown(false)  // 새로 추가한 변수 초기화
     , bMulticastEnabled(false)
 {
+    // 와이어 포맷용 숫자 송신자 ID
+    InstanceNumericID = FTimecodeNetworkMessage::MakeSenderNumericID(InstanceID);
+    TimecodeFrameRate = 30.0f;
+    LastSentSequence = 0;
+    ServoSenderID = 0;
+    bServoResetRequested = false;
+    bBatching = false;
+    DelayRequestTimer = 0.0f;
+    HeartbeatTimer = 0.0f;
+    DelayResponsePruneTime = 0.0;
+    PendingDelayRequestTime = 0.0;
+    ServoRoundTripDelay = 0.0;
+    ServoMeasuredOffset = 0.0;
+    ServoPlaybackRate = 1.0;
+    ServoTransportGeneration = 0;
+    TransportSenderID = 0;
+    TransportGeneration = 0;
+    LastTransportTimestamp = 0.0;
+    TransportRefreshTimer = 0.0f;
+    PLLLastPhaseError = 0.0;
+    bServoSlewing = false;
+    BatchSize = 0;
+
+    // 수신 인박스 정책 (슬롯은 Initialize에서 할당)
+    const UTimecodeSettings* Settings = GetDefault<UTimecodeSettings>();
+    Inbox.SetDropPolicy(Settings ? Settings->InboxDropPolicy : ETimecodeInboxDropPolicy::DropOldest);
+
+    // 경로 지연 보상 (이전에는 설정만 있고 사용되지 않았음)
+    bLatencyCompensation = Settings ? Settings->bEnableNetworkLatencyCompensation : true;
+    DelayRequestInterval = Settings ? Settings->DelayRequestInterval : 1.0f;
+    ClockFilterMode = Settings ? Settings->ClockFilterMode : ETimecodeClockFilterMode::MinimumDelay;
+
+    // 홀드오버
+    HoldoverThreshold = Settings ? Settings->HoldoverThreshold : 1.0f;
+    MaxSlewRate = (Settings ? Settings->MaxSlewRatePPM : 500.0f) * 1e-6;
+
+    // 유니캐스트 팬아웃
+    bUnicastFanOut = Settings ? Settings->bEnableUnicastFanOut : true;
+    SlaveTimeout = Settings ? Settings->SlaveTimeout : 6.0f;
+    JoinTimer = 0.0f;
+    bIsRelayMode = Settings ? Settings->bIsRelayNode : false;
+
+    // 마스터 선출
+    bElectionEnabled = Settings ? Settings->bEnableMasterElection : false;
+    ElectionTimeout = Settings ? Settings->ElectionTimeout : 6.0f;
+    LocalElectionInfo.Priority = static_cast<uint8>(FMath::Clamp(Settings ? Settings->MasterPriority : 128, 0, 255));
+    LocalElectionInfo.ClockQuality = static_cast<uint8>(FMath::Clamp(Settings ? Settings->ClockQuality : 248, 0, 255));
+    ElectedMasterID = 0;
+    CreationTime = FPlatformTime::Seconds();
+    ElectionListenUntil = 0.0;
+
     // Basic initialization complete
     UE_LOG(LogTimecodeNetwork, Verbose, TEXT("TimecodeNetworkManager created with ID: %s"), *InstanceID);
 
@@ -68,16 +127,25 @@ bool UTimecodeNetworkManager::Initialize(bool bIsMaster, int32 Port)
     }
 
     // 이미 초기화된 경우 정리
-    if (Socket != nullptr || Receiver != nullptr)
+    if (Socket != nullptr || Receiver != nullptr || NativeSocket != nullptr)
     {
         UE_LOG(LogTimecodeNetwork, Warning, TEXT("Already initialized, shutting down first"));
         Shutdown();
     }
 
+    // Shutdown이 남긴 종료 플래그 해제 (재초기화 후에도 수신/인박스 처리가 계속되도록)
+    bIsShuttingDown = false;
+
     // 상태 초기화
     ConnectionState = ENetworkConnectionState::Disconnected;
     bHasReceivedValidMessage = false;
     bMulticastEnabled = false; // 멀티캐스트는 기본적으로 비활성화
+    SenderSequences.Empty();
+    {
+        FScopeLock RegistryLock(&SlaveRegistryLock);
+        SlaveRegistry.Reset();
+    }
+    JoinTimer = 0.0f;
 
     // 포트 설정
     ReceivePortNumber = Port;
@@ -100,6 +168,24 @@ bool UTimecodeNetworkManager::Initialize(bool bIsMaster, int32 Port)
         UE_LOG(LogTimecodeNetwork, Log, TEXT("Manual role: %s"), bIsMasterMode ? TEXT("MASTER") : TEXT("SLAVE"));
     }
 
+    // 릴레이는 상위 마스터 쪽에서는 슬레이브로 동작
+    if (bIsRelayMode)
+    {
+        bIsMasterMode = false;
+        UE_LOG(LogTimecodeNetwork, Log, TEXT("Relay role: following upstream master, serving joined slaves"));
+    }
+
+    // 선출: 슬레이브로 시작해 한 타임아웃 동안 기존 마스터의 하트비트를 기다린 뒤 결정
+    Election.Reset();
+    ElectedMasterID = 0;
+    if (IsElectionActive())
+    {
+        bIsMasterMode = false;
+        ElectionListenUntil = FPlatformTime::Seconds() + ElectionTimeout;
+        UE_LOG(LogTimecodeNetwork, Log, TEXT("Master election: listening for %.1f s (priority %d, clock quality %d)"),
+            ElectionTimeout, LocalElectionInfo.Priority, LocalElectionInfo.ClockQuality);
+    }
+
     // 소켓 생성
     ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
     if (!SocketSubsystem)
@@ -108,14 +194,57 @@ bool UTimecodeNetworkManager::Initialize(bool bIsMaster, int32 Port)
         return false;
     }
 
+    // Linux: 네이티브 소켓이 수신 포트에서 송수신을 맡고, FSocket은 임시 포트에 바인딩
+    OpenNativeSocket();
+
     if (!CreateSocket())
     {
         UE_LOG(LogTimecodeNetwork, Error, TEXT("Failed to create UDP socket"));
+        CloseNativeSocket();
         return false;
     }
 
+    // 서보 초기화 (수신 스레드 시작 전이므로 직접 수행)
+    InitializePLL();
+    ServoSequenceWindow.Reset();
+    ServoSenderID = 0;
+    bServoResetRequested = false;
+    PendingDelayRequestTime = 0.0;
+    DelayRequestTimer = 0.0f;
+    DelayResponseTimes.Empty();
+    DelayResponsePruneTime = 0.0;
+    RelaySequences.Empty();
+    ClockFilter.Reset();
+    ServoRoundTripDelay = 0.0;
+    ServoMeasuredOffset = 0.0;
+    ServoPlaybackRate = 1.0;
+    ServoTransportGeneration = 0;
+    TransportSenderID = 0;
+    TransportGeneration = 0;
+    TransportRefreshTimer = 0.0f;
+    HeartbeatTimer = 0.0f;
+
+    // 수신 인박스 준비 (수신 스레드 시작 전)
+    if (!Inbox.IsInitialized())
+    {
+        const UTimecodeSettings* Settings = GetDefault<UTimecodeSettings>();
+        Inbox.Initialize(Settings ? Settings->InboxCapacity : 256, TimecodeWire::MaxDatagramSize);
+    }
+
     // UDP 수신 설정
-    if (Socket)
+    if (Socket && NativeSocket)
+    {
+        if (!StartNativeSocket())
+        {
+            UE_LOG(LogTimecodeNetwork, Error, TEXT("Failed to start native socket receive thread"));
+            CloseNativeSocket();
+            Socket->Close();
+            SocketSubsystem->DestroySocket(Socket);
+            Socket = nullptr;
+            return false;
+        }
+    }
+    else if (Socket)
     {
         FTimespan ThreadWaitTime = FTimespan::FromMilliseconds(100);
         Receiver = new FUdpSocketReceiver(Socket, ThreadWaitTime, TEXT("TimecodeReceiver"));
@@ -164,6 +293,8 @@ void UTimecodeNetworkManager::Shutdown()
     // 즉시 종료 플래그 설정
     bIsShuttingDown = true;
     bHasReceivedValidMessage = false;
+    bBatching = false;
+    BatchSize = 0;
 
     // 진행 중인 콜백 완료를 위한 짧은 대기
     FPlatformProcess::Sleep(0.1f);
@@ -175,6 +306,17 @@ void UTimecodeNetworkManager::Shutdown()
         delete Receiver;
         Receiver = nullptr;
     }
+    CloseNativeSocket();
+
+    // 리시버 정지 후 남은 패킷 폐기
+    if (Inbox.IsInitialized())
+    {
+        Inbox.Reset();
+    }
+    {
+        FScopeLock RegistryLock(&SlaveRegistryLock);
+        SlaveRegistry.Reset();
+    }
 
     // 소켓 정리
     if (Socket)
@@ -216,101 +358,240 @@ bool UTimecodeNetworkManager::SendTimecodeMessage(const FString& Timecode, ETime
         return false;
     }
 
-    // 메시지 준비
-    FTimecodeNetworkMessage Message;
+    // 메시지 준비 (스택 버퍼에 직접 인코딩 - 힙 할당 없음)
+    FTimecodeMessageView Message;
     Message.MessageType = MessageType;
-    Message.Timecode = Timecode;
-    Message.Timestamp = FPlatformTime::Seconds();
-    Message.SenderID = InstanceID;
-    Message.Data = TEXT("");
+    Message.SetTimecode(Timecode, TimecodeFrameRate);
+    Message.Timestamp = GetServedTime(FPlatformTime::Seconds());
+    Message.SenderID = InstanceNumericID;
+    Message.Sequence = AllocateSequence();
+
+    // 선출 중인 노드의 하트비트에는 우선순위/클럭 품질/가동 시간을 실음
+    uint8 ElectionPayload[FTimecodeElectionInfo::PayloadSize];
+    if (MessageType == ETimecodeMessageType::Heartbeat && IsElectionActive())
+    {
+        FTimecodeElectionInfo Info = LocalElectionInfo;
+        Info.bIsMaster = bIsMasterMode;
+        Info.UptimeSeconds = static_cast<uint32>(FPlatformTime::Seconds() - CreationTime);
+
+        Message.Flags |= TimecodeWire::FlagElection;
+        Message.Payload = ElectionPayload;
+        Message.PayloadLength = static_cast<uint16>(Info.Encode(ElectionPayload));
+    }
+
+    uint8 Buffer[TimecodeWire::HeaderSize + FTimecodeElectionInfo::PayloadSize];
+    return QueueOrSend(TArrayView<const uint8>(Buffer, Message.Encode(Buffer)));
+}
 
-    TArray<uint8> MessageData = Message.Serialize();
+bool UTimecodeNetworkManager::SendDatagram(TArrayView<const uint8> Datagram)
+{
     int32 BytesSent = 0;
     bool bSendSuccess = false;
 
     // 송신 우선순위 결정:
     // 1. 특정 대상 (수동 슬레이브 모드)
     // 2. 멀티캐스트 (활성화된 경우)
-    // 3. 유니캐스트 (지정된 타겟 IP)
-    // 4. 브로드캐스트 (최후 수단)
+    // 3. 유니캐스트 팬아웃 (마스터, Join으로 등록된 슬레이브)
+    // 4. 유니캐스트 (지정된 타겟 IP)
+    // 5. 브로드캐스트 (최후 수단)
 
     // 1. 수동 슬레이브 모드에서 마스터로 직접 전송
     if (RoleMode == ETimecodeRoleMode::Manual && !bIsMasterMode && !MasterIPAddress.IsEmpty())
     {
-        bSendSuccess = SendToSpecificIP(MessageData, MasterIPAddress, BytesSent,
-            FString::Printf(TEXT("Master (%s)"), *MasterIPAddress));
+        bSendSuccess = SendToSpecificIP(Datagram, MasterEndpoint, MasterIPAddress, BytesSent, TEXT("Master"));
     }
     // 2. 멀티캐스트 모드 활성화된 경우
     else if (bMulticastEnabled && !MulticastGroupAddress.IsEmpty())
     {
-        bSendSuccess = SendToMulticastGroup(MessageData, BytesSent);
+        bSendSuccess = SendToMulticastGroup(Datagram, BytesSent);
+    }
+    // 3. 등록된 모든 슬레이브에 한 번에 전송 (네이티브 백엔드는 sendmmsg)
+    else if (bIsMasterMode && bUnicastFanOut && SlaveRegistry.Num() > 0)
+    {
+        const TArrayView<const FInternetAddr* const> Destinations = SlaveRegistry.GetDestinations();
+        const int32 SentCount = SendToMany(Datagram, Destinations);
+        if (SentCount < Destinations.Num())
+        {
+            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Fan-out reached %d of %d slaves"), SentCount, Destinations.Num());
+        }
+        return SentCount == Destinations.Num();
     }
-    // 3. 유니캐스트 (지정된 타겟 IP)
+    // 4. 유니캐스트 (지정된 타겟 IP)
     else if (!TargetIPAddress.IsEmpty())
     {
-        bSendSuccess = SendToSpecificIP(MessageData, TargetIPAddress, BytesSent,
-            FString::Printf(TEXT("Target (%s)"), *TargetIPAddress));
+        bSendSuccess = SendToSpecificIP(Datagram, TargetEndpoint, TargetIPAddress, BytesSent, TEXT("Target"));
     }
-    // 4. 최후 수단: 브로드캐스트
+    // 5. 최후 수단: 브로드캐스트
     else
     {
         UE_LOG(LogTimecodeNetwork, Warning, TEXT("No transmission target specified. Message will not be sent."));
         return false;
     }
 
-    return bSendSuccess && (BytesSent == MessageData.Num());
+    return bSendSuccess && (BytesSent == Datagram.Num());
 }
 
-// 특정 IP로 메시지 전송 헬퍼 함수
-bool UTimecodeNetworkManager::SendToSpecificIP(const TArray<uint8>& MessageData, const FString& IPAddress,
-    int32& BytesSent, const FString& TargetName)
+bool UTimecodeNetworkManager::QueueOrSend(TArrayView<const uint8> MessageData)
+{
+    if (MessageData.Num() == 0)
+    {
+        return false;
+    }
+
+    if (!bBatching)
+    {
+        return SendDatagram(MessageData);
+    }
+
+    // MTU를 넘기 전에 현재까지 모은 데이터그램을 먼저 전송
+    bool bSendSuccess = true;
+    if (BatchSize + MessageData.Num() > TimecodeWire::MaxDatagramSize)
+    {
+        bSendSuccess = SendDatagram(TArrayView<const uint8>(BatchBuffer, BatchSize));
+        BatchSize = 0;
+    }
+
+    FMemory::Memcpy(BatchBuffer + BatchSize, MessageData.GetData(), MessageData.Num());
+    BatchSize += MessageData.Num();
+    return bSendSuccess;
+}
+
+void UTimecodeNetworkManager::BeginBatch()
+{
+    bBatching = true;
+}
+
+bool UTimecodeNetworkManager::FlushBatch()
+{
+    bBatching = false;
+    if (BatchSize == 0)
+    {
+        return true;
+    }
+
+    if (Socket == nullptr || ConnectionState != ENetworkConnectionState::Connected)
+    {
+        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Cannot flush batch: Socket not connected"));
+        BatchSize = 0;
+        return false;
+    }
+
+    UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Flushing batched datagram (%d bytes)"), BatchSize);
+
+    const bool bSendSuccess = SendDatagram(TArrayView<const uint8>(BatchBuffer, BatchSize));
+    BatchSize = 0;
+    return bSendSuccess;
+}
+
+FInternetAddr* UTimecodeNetworkManager::ResolveEndpoint(FTimecodeCachedEndpoint& Endpoint, const FString& Address)
 {
+    // 캐시 적중 - 문자열 파싱이나 주소 객체 할당 없음
+    if (Endpoint.Addr.IsValid() && Endpoint.Port == SendPortNumber)
+    {
+        return Endpoint.Addr.Get();
+    }
+
     ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
-    TSharedRef<FInternetAddr> TargetAddr = SocketSubsystem->CreateInternetAddr();
+    if (!SocketSubsystem)
+    {
+        return nullptr;
+    }
 
+    TSharedRef<FInternetAddr> Addr = SocketSubsystem->CreateInternetAddr();
     bool bIsValid = false;
-    TargetAddr->SetIp(*IPAddress, bIsValid);
-
+    Addr->SetIp(*Address, bIsValid);
     if (!bIsValid)
+    {
+        Endpoint.Invalidate();
+        return nullptr;
+    }
+
+    Addr->SetPort(SendPortNumber);
+    Endpoint.Addr = Addr;
+    Endpoint.Port = SendPortNumber;
+    return Endpoint.Addr.Get();
+}
+
+void UTimecodeNetworkManager::InvalidateEndpoints()
+{
+    TargetEndpoint.Invalidate();
+    MasterEndpoint.Invalidate();
+    MulticastEndpoint.Invalidate();
+}
+
+// 특정 IP로 메시지 전송 헬퍼 함수
+bool UTimecodeNetworkManager::SendToSpecificIP(TArrayView<const uint8> MessageData, FTimecodeCachedEndpoint& Endpoint,
+    const FString& IPAddress, int32& BytesSent, const TCHAR* TargetName)
+{
+    FInternetAddr* TargetAddr = ResolveEndpoint(Endpoint, IPAddress);
+    if (TargetAddr == nullptr)
     {
         UE_LOG(LogTimecodeNetwork, Error, TEXT("Invalid IP address: %s"), *IPAddress);
         return false;
     }
 
-    TargetAddr->SetPort(SendPortNumber);
-    bool bSendSuccess = Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *TargetAddr);
+    bool bSendSuccess = SendRaw(MessageData, *TargetAddr, BytesSent);
 
     if (bSendSuccess)
     {
-        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent message to %s (Port: %d)"),
-            *TargetName, SendPortNumber);
+        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent message to %s (%s, Port: %d)"),
+            TargetName, *IPAddress, SendPortNumber);
     }
     else
     {
-        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Failed to send message to %s"), *TargetName);
+        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Failed to send message to %s (%s)"), TargetName, *IPAddress);
     }
 
     return bSendSuccess;
 }
 
-// 멀티캐스트 그룹으로 메시지 전송 헬퍼 함수
-bool UTimecodeNetworkManager::SendToMulticastGroup(const TArray<uint8>& MessageData, int32& BytesSent)
+bool UTimecodeNetworkManager::SendRaw(TArrayView<const uint8> Datagram, const FInternetAddr& Destination, int32& BytesSent)
 {
-    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
-    TSharedRef<FInternetAddr> MulticastAddr = SocketSubsystem->CreateInternetAddr();
+#if PLATFORM_LINUX
+    if (NativeSocket)
+    {
+        // 수신 포트에서 송신하므로 상대는 FSocket 경로와 같은 출발 포트를 보게 됨
+        BytesSent = NativeSocket->SendTo(Datagram.GetData(), Datagram.Num(), Destination);
+        return BytesSent >= 0;
+    }
+#endif
+    return Socket != nullptr && Socket->SendTo(Datagram.GetData(), Datagram.Num(), BytesSent, Destination);
+}
 
-    bool bIsValid = false;
-    MulticastAddr->SetIp(*MulticastGroupAddress, bIsValid);
+int32 UTimecodeNetworkManager::SendToMany(TArrayView<const uint8> Datagram, TArrayView<const FInternetAddr* const> Destinations)
+{
+#if PLATFORM_LINUX
+    if (NativeSocket)
+    {
+        return NativeSocket->SendToMany(Datagram.GetData(), Datagram.Num(), Destinations);
+    }
+#endif
 
-    if (!bIsValid)
+    // 폴백: 대상마다 SendTo 한 번
+    int32 SentCount = 0;
+    for (const FInternetAddr* Destination : Destinations)
+    {
+        int32 BytesSent = 0;
+        if (SendRaw(Datagram, *Destination, BytesSent) && BytesSent == Datagram.Num())
+        {
+            ++SentCount;
+        }
+    }
+    return SentCount;
+}
+
+// 멀티캐스트 그룹으로 메시지 전송 헬퍼 함수
+bool UTimecodeNetworkManager::SendToMulticastGroup(TArrayView<const uint8> MessageData, int32& BytesSent)
+{
+    FInternetAddr* MulticastAddr = ResolveEndpoint(MulticastEndpoint, MulticastGroupAddress);
+    if (MulticastAddr == nullptr)
     {
         UE_LOG(LogTimecodeNetwork, Error, TEXT("Invalid multicast address: %s"), *MulticastGroupAddress);
         bMulticastEnabled = false; // 잘못된 주소이므로 멀티캐스트 비활성화
         return false;
     }
 
-    MulticastAddr->SetPort(SendPortNumber);
-    bool bSendSuccess = Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *MulticastAddr);
+    bool bSendSuccess = SendRaw(MessageData, *MulticastAddr, BytesSent);
 
     if (bSendSuccess)
     {
@@ -337,82 +618,28 @@ bool UTimecodeNetworkManager::SendEventMessage(const FString& EventName, const F
         return false;
     }
 
-    // Serialize message
-    FTimecodeNetworkMessage Message;
+    // 메시지 준비 (스택 버퍼에 직접 인코딩 - 이벤트 이름은 UTF-8 페이로드)
+    FTimecodeMessageView Message;
     Message.MessageType = ETimecodeMessageType::Event;
-    Message.Timecode = Timecode;
-    Message.Data = EventName;
+    Message.SetTimecode(Timecode, TimecodeFrameRate);
     Message.Timestamp = FPlatformTime::Seconds();
-    Message.SenderID = InstanceID;
-
-    // Serialize message
-    TArray<uint8> MessageData = Message.Serialize();
-
-    // Send message (choose between multicast group or single target IP)
-    int32 BytesSent = 0;
-
-    // Transmission priority: Multicast > TargetIP > MasterIP
-    if (!MulticastGroupAddress.IsEmpty())
-    {
-        // Send to multicast group
-        TSharedRef<FInternetAddr> MulticastAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-        bool bIsValid = false;
-        MulticastAddr->SetIp(*MulticastGroupAddress, bIsValid);
-        if (!bIsValid)
-        {
-            UE_LOG(LogTimecodeNetwork, Error, TEXT("Invalid multicast group: %s"), *MulticastGroupAddress);
-            return false;
-        }
-        MulticastAddr->SetPort(SendPortNumber);  // 올바른 타겟 포트 사용
-
-        Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *MulticastAddr);
-
-        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent event '%s' to multicast group: %s (Port: %d)"),
-            *EventName, *MulticastGroupAddress, SendPortNumber);
-    }
-    else if (!TargetIPAddress.IsEmpty())
-    {
-        // Send to single target IP
-        TSharedRef<FInternetAddr> TargetAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-        bool bIsValid = false;
-        TargetAddr->SetIp(*TargetIPAddress, bIsValid);
-        if (!bIsValid)
-        {
-            UE_LOG(LogTimecodeNetwork, Error, TEXT("Invalid target IP: %s"), *TargetIPAddress);
-            return false;
-        }
-        TargetAddr->SetPort(SendPortNumber);  // 올바른 타겟 포트 사용
+    Message.SenderID = InstanceNumericID;
+    Message.Sequence = AllocateSequence();
 
-        Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *TargetAddr);
-
-        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent event '%s' to target: %s (Port: %d)"),
-            *EventName, *TargetIPAddress, SendPortNumber);
-    }
-    else if (RoleMode == ETimecodeRoleMode::Manual && !bIsMasterMode && !MasterIPAddress.IsEmpty())
-    {
-        // Send to master IP in manual slave mode
-        TSharedRef<FInternetAddr> MasterAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-        bool bIsValid = false;
-        MasterAddr->SetIp(*MasterIPAddress, bIsValid);
-        if (!bIsValid)
-        {
-            UE_LOG(LogTimecodeNetwork, Error, TEXT("Invalid master IP: %s"), *MasterIPAddress);
-            return false;
-        }
-        MasterAddr->SetPort(SendPortNumber);  // 올바른 타겟 포트 사용
+    const FTCHARToUTF8 EventNameUtf8(*EventName);
+    Message.Payload = reinterpret_cast<const uint8*>(EventNameUtf8.Get());
+    Message.PayloadLength = static_cast<uint16>(FMath::Min(EventNameUtf8.Length(), TimecodeWire::MaxPayloadSize));
 
-        Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *MasterAddr);
+    uint8 Buffer[TimecodeWire::MaxMessageSize];
+    const TArrayView<const uint8> MessageData(Buffer, Message.Encode(Buffer));
 
-        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent event '%s' to master: %s (Port: %d)"),
-            *EventName, *MasterIPAddress, SendPortNumber);
-    }
-    else
+    // 다른 메시지와 같은 경로로 전송 (멀티캐스트, 유니캐스트 팬아웃, 대상 IP; 배치 중이면 같은 데이터그램에)
+    const bool bSendSuccess = QueueOrSend(MessageData);
+    if (!bSendSuccess)
     {
-        UE_LOG(LogTimecodeNetwork, Error, TEXT("No target IP or multicast group specified"));
-        return false;
+        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Failed to send event '%s'"), *EventName);
     }
-
-    return BytesSent == MessageData.Num();
+    return bSendSuccess;
 }
 
 void UTimecodeNetworkManager::SetTargetIP(const FString& IPAddress)
@@ -420,6 +647,7 @@ void UTimecodeNetworkManager::SetTargetIP(const FString& IPAddress)
     if (TargetIPAddress != IPAddress)
     {
         TargetIPAddress = IPAddress;
+        TargetEndpoint.Invalidate();
         UE_LOG(LogTimecodeNetwork, Log, TEXT("Target IP set to: %s"), *TargetIPAddress);
     }
 }
@@ -507,6 +735,7 @@ void UTimecodeNetworkManager::SetMasterIPAddress(const FString& InMasterIP)
     if (MasterIPAddress != InMasterIP)
     {
         MasterIPAddress = InMasterIP;
+        MasterEndpoint.Invalidate();
 
         UE_LOG(LogTimecodeNetwork, Log, TEXT("Master IP address changed to: %s"), *MasterIPAddress);
 
@@ -544,8 +773,12 @@ bool UTimecodeNetworkManager::JoinMulticastGroup(const FString& MulticastGroup)
         return false;
     }
 
-    // 멀티캐스트 그룹 참여 시도
+    // 멀티캐스트 그룹 참여 시도 (수신 소켓에서)
+#if PLATFORM_LINUX
+    bool bJoinSuccess = NativeSocket ? NativeSocket->JoinMulticastGroup(MulticastGroup) : Socket->JoinMulticastGroup(*GroupAddr);
+#else
     bool bJoinSuccess = Socket->JoinMulticastGroup(*GroupAddr);
+#endif
 
     if (!bJoinSuccess)
     {
@@ -558,6 +791,7 @@ bool UTimecodeNetworkManager::JoinMulticastGroup(const FString& MulticastGroup)
         if (TargetIPAddress.IsEmpty())
         {
             TargetIPAddress = TEXT("127.0.0.1");
+            TargetEndpoint.Invalidate();
             UE_LOG(LogTimecodeNetwork, Log, TEXT("Fallback to unicast mode with target IP: %s"), *TargetIPAddress);
         }
 
@@ -566,6 +800,7 @@ bool UTimecodeNetworkManager::JoinMulticastGroup(const FString& MulticastGroup)
 
     // 멀티캐스트 참여 성공
     MulticastGroupAddress = MulticastGroup;
+    MulticastEndpoint.Invalidate();
     bMulticastEnabled = true;
     UE_LOG(LogTimecodeNetwork, Log, TEXT("Joined multicast group: %s"), *MulticastGroup);
     return true;
@@ -606,19 +841,23 @@ bool UTimecodeNetworkManager::CreateSocket()
         Socket->SetNonBlocking();
         Socket->SetBroadcast();
 
-        // Set local address
+        // Set local address (수신 포트를 네이티브 소켓이 점유한 경우 임시 포트)
+        const bool bSendOnly = NativeSocket != nullptr;
         TSharedRef<FInternetAddr> LocalAddr = SocketSubsystem->CreateInternetAddr();
         LocalAddr->SetAnyAddress();
-        LocalAddr->SetPort(CurrentPort);
+        LocalAddr->SetPort(bSendOnly ? 0 : CurrentPort);
 
         // Try to bind socket
         if (Socket->Bind(*LocalAddr))
         {
             // 성공적으로 바인딩됨
-            ReceivePortNumber = CurrentPort;  // 실제 사용된 포트 업데이트
+            if (!bSendOnly)
+            {
+                ReceivePortNumber = CurrentPort;  // 실제 사용된 포트 업데이트
+            }
             bSocketCreated = true;
             UE_LOG(LogTimecodeNetwork, Log, TEXT("UDP socket created and bound to port %d (attempt %d)"),
-                CurrentPort, Attempt + 1);
+                bSendOnly ? Socket->GetPortNo() : CurrentPort, Attempt + 1);
             break;
         }
         else
@@ -645,37 +884,174 @@ bool UTimecodeNetworkManager::CreateSocket()
 }
 
 void UTimecodeNetworkManager::OnUDPReceived(const FArrayReaderPtr& DataPtr, const FIPv4Endpoint& Endpoint)
+{
+    // 도착 시각은 가능한 한 빨리 기록
+    const double ArrivalTime = FPlatformTime::Seconds();
+
+    if (!DataPtr.IsValid())
+    {
+        return;
+    }
+
+    UE_LOG(LogTimecodeNetwork, VeryVerbose, TEXT("UDP packet received from %s"), *Endpoint.ToString());
+
+    HandleDatagram(DataPtr->GetData(), DataPtr->Num(), ArrivalTime, Endpoint);
+}
+
+void UTimecodeNetworkManager::HandleDatagram(const uint8* Data, int32 Num, double ArrivalTime, const FIPv4Endpoint& Source)
 {
     // 안전 체크
-    if (bIsShuttingDown || !IsValid(this) || !DataPtr.IsValid() || DataPtr->Num() <= 0)
+    if (bIsShuttingDown || !IsValid(this) || Data == nullptr || Num <= 0)
     {
         return;
     }
 
     // 메시지 크기 확인 (최소 필요 크기 검증)
     const int32 MinValidSize = 10; // 최소 유효 크기
-    if (DataPtr->Num() < MinValidSize)
+    if (Num < MinValidSize)
     {
-        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Received undersized packet (%d bytes)"), DataPtr->Num());
+        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Received undersized packet (%d bytes)"), Num);
         return;
     }
 
-    // 메시지 타입 직접 검사
-    uint8 MessageType = (*DataPtr)[0];
-    // 유효한 메시지 타입인지 확인 (0부터 4까지가 유효)
-    if (MessageType > 4) // ETimecodeMessageType의 최대값 (Command = 4)
+    // 메시지 타입 직접 검사 (v2 헤더는 매직 다음에 타입, 레거시 포맷은 첫 바이트가 타입)
+    const bool bHasWireHeader = TimecodeWire::HasWireHeader(Data, Num);
+    uint8 MessageType = bHasWireHeader ? Data[3] : Data[0];
+    // 유효한 메시지 타입인지 확인
+    if (MessageType > static_cast<uint8>(ETimecodeMessageType::Join))
     {
         UE_LOG(LogTimecodeNetwork, Warning, TEXT("Invalid message type: %d"), MessageType);
         return;
     }
 
     // 디버깅 로그
-    UE_LOG(LogTimecodeNetwork, Verbose, TEXT("UDP packet received from %s, size: %d bytes, type: %d"),
-        *Endpoint.ToString(), DataPtr->Num(), MessageType);
+    UE_LOG(LogTimecodeNetwork, Verbose, TEXT("UDP packet received, size: %d bytes, type: %d"), Num, MessageType);
+
+    // 헤더만 미리 검증 (수신 버퍼 위에서 디코딩, 복사/할당 없음)
+    FTimecodeMessageView View;
+    if (bHasWireHeader && !FTimecodeMessageView::Decode(MakeArrayView(Data, Num), View))
+    {
+        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Failed to decode message header"));
+        return;
+    }
+
+    // 서보 갱신과 지연 측정은 게임 스레드를 기다리지 않고 수신 스레드에서 바로 처리
+    if (bHasWireHeader)
+    {
+        FTimecodeMessageView Sample = View;
+        int32 Offset = 0;
+        do
+        {
+            // 릴레이: 인박스를 거치지 않고 바로 하위로 재전송 (게임 스레드 프레임 대기 없음)
+            if (bIsRelayMode)
+            {
+                ForwardDownstream(Sample, ArrivalTime);
+            }
+            HandleTimingMessage(Sample, ArrivalTime, Source);
+            Offset += Sample.GetEncodedSize();
+        } while (Offset < Num &&
+            FTimecodeMessageView::Decode(MakeArrayView(Data + Offset, Num - Offset), Sample));
+    }
+    else if (bIsRelayMode || (!bIsMasterMode && MessageType == static_cast<uint8>(ETimecodeMessageType::TimecodeSync)))
+    {
+        // 레거시 포맷 (시퀀스 없음): v2 뷰로 바꿔 릴레이 재전송과 서보 갱신
+        FTimecodeNetworkMessage LegacyMessage;
+        uint8 LegacyBuffer[TimecodeWire::MaxMessageSize];
+        FTimecodeMessageView Sample;
+        const int32 LegacySize = LegacyMessage.Deserialize(TArray<uint8>(Data, Num)) ?
+            LegacyMessage.Serialize(MakeArrayView(LegacyBuffer)) : 0;
+        if (LegacySize > 0 && FTimecodeMessageView::Decode(MakeArrayView(LegacyBuffer, LegacySize), Sample))
+        {
+            if (bIsRelayMode)
+            {
+                ForwardDownstream(Sample, ArrivalTime);
+            }
+            if (!bIsMasterMode && Sample.MessageType == ETimecodeMessageType::TimecodeSync)
+            {
+                UpdateServo(Sample, ArrivalTime);
+            }
+        }
+    }
+
+    // 게임 스레드가 다음 Tick에서 꺼내 처리하도록 인박스에 복사 (패킷당 태스크 생성 없음)
+    if (!Inbox.Enqueue(Data, Num, Source, ArrivalTime))
+    {
+        UE_LOG(LogTimecodeNetwork, VeryVerbose, TEXT("Inbox full or packet oversized, datagram dropped (%d bytes)"), Num);
+    }
+}
+
+bool UTimecodeNetworkManager::OpenNativeSocket()
+{
+#if PLATFORM_LINUX
+    const UTimecodeSettings* Settings = GetDefault<UTimecodeSettings>();
+    if (!Settings || !Settings->bUseNativeSocketBackend || NativeSocket != nullptr)
+    {
+        return NativeSocket != nullptr;
+    }
+
+    // CreateSocket과 동일하게 최대 5개 포트 시도
+    const int32 MaxPortAttempts = 5;
+    int32 BoundPort = ReceivePortNumber;
+
+    NativeSocket = new FTimecodeLinuxSocket(Settings->SocketBatchSize);
+    if (NativeSocket->Open(ReceivePortNumber, MaxPortAttempts, BoundPort))
+    {
+        ReceivePortNumber = BoundPort;
+        NativeSocket->OnDatagramReceived().BindUObject(this, &UTimecodeNetworkManager::HandleDatagram);
+        return true;
+    }
+
+    UE_LOG(LogTimecodeNetwork, Warning, TEXT("Native socket backend unavailable, falling back to FUdpSocketReceiver"));
+    delete NativeSocket;
+    NativeSocket = nullptr;
+#endif
+    return false;
+}
+
+bool UTimecodeNetworkManager::StartNativeSocket()
+{
+#if PLATFORM_LINUX
+    return NativeSocket != nullptr && NativeSocket->StartThread();
+#else
+    return false;
+#endif
+}
+
+void UTimecodeNetworkManager::CloseNativeSocket()
+{
+#if PLATFORM_LINUX
+    if (NativeSocket)
+    {
+        NativeSocket->Shutdown();
+        delete NativeSocket;
+        NativeSocket = nullptr;
+    }
+#endif
+}
+
+bool UTimecodeNetworkManager::IsUsingKernelTimestamps() const
+{
+#if PLATFORM_LINUX
+    return NativeSocket != nullptr && NativeSocket->HasKernelTimestamps();
+#else
+    return false;
+#endif
+}
 
-    // 메시지 복사
-    TArray<uint8> MessageData;
-    MessageData.Append(DataPtr->GetData(), DataPtr->Num());
+void UTimecodeNetworkManager::DrainInbox()
+{
+    const int32 Drained = Inbox.Drain([this](const uint8* Data, int32 Num, const FIPv4Endpoint& Source, double ArrivalTime)
+        {
+            if (IsValid(this) && !bIsShuttingDown)
+            {
+                ProcessDatagram(Data, Num, Source, ArrivalTime);
+            }
+        });
+
+    if (Drained == 0)
+    {
+        return;
+    }
 
     // 마지막 수신 시간 업데이트
     LastMessageTime = FDateTime::Now();
@@ -686,47 +1062,47 @@ void UTimecodeNetworkManager::OnUDPReceived(const FArrayReaderPtr& DataPtr, cons
         UE_LOG(LogTimecodeNetwork, Log, TEXT("Connection restored"));
         ResetConnectionStatus();
     }
+}
 
-    // 메인 스레드로 작업 예약
-    FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this, MessageData]()
-        {
-            // 메인 스레드에서 재검사
-            if (!IsValid(this) || bIsShuttingDown)
-            {
-                return;
-            }
+void UTimecodeNetworkManager::ProcessDatagram(const uint8* Data, int32 Num, const FIPv4Endpoint& Source, double ArrivalTime)
+{
+    FTimecodeMessageView ReceivedView;
 
-            // 메시지 역직렬화
-            FTimecodeNetworkMessage ReceivedMessage;
-            if (ReceivedMessage.Deserialize(MessageData))
-            {
-                // 유효한 메시지 처리
-                bHasReceivedValidMessage = true;
+    // 레거시 문자열 포맷은 호환 디코더로 읽은 뒤 v2로 재인코딩하여 같은 경로로 처리
+    if (!TimecodeWire::HasWireHeader(Data, Num))
+    {
+        uint8 LegacyBuffer[TimecodeWire::MaxMessageSize];
+        FTimecodeNetworkMessage LegacyMessage;
+        const int32 LegacySize = LegacyMessage.Deserialize(TArray<uint8>(Data, Num)) ?
+            LegacyMessage.Serialize(MakeArrayView(LegacyBuffer)) : 0;
+        if (LegacySize == 0 || !FTimecodeMessageView::Decode(MakeArrayView(LegacyBuffer, LegacySize), ReceivedView))
+        {
+            UE_LOG(LogTimecodeNetwork, Warning, TEXT("Failed to deserialize message"));
+            return;
+        }
 
-                // 메시지 처리 전 다시 유효성 검사
-                if (IsValid(this) && !bIsShuttingDown)
-                {
-                    ProcessMessage(ReceivedMessage);
+        bHasReceivedValidMessage = true;
+        ProcessMessage(ReceivedView, Source, ArrivalTime);
+        return;
+    }
 
-                    // 델리게이트 호출 전 유효성 검사
-                    if (IsValid(this) && !bIsShuttingDown && OnMessageReceived.IsBound())
-                    {
-                        OnMessageReceived.Broadcast(ReceivedMessage);
-                    }
-                }
-            }
-            else
-            {
-                UE_LOG(LogTimecodeNetwork, Warning, TEXT("Failed to deserialize message"));
-            }
-        }, TStatId(), nullptr, ENamedThreads::GameThread);
+    // 배치 데이터그램이면 이어지는 메시지를 각각 처리
+    int32 Offset = 0;
+    while (Offset < Num && IsValid(this) && !bIsShuttingDown &&
+        FTimecodeMessageView::Decode(MakeArrayView(Data + Offset, Num - Offset), ReceivedView))
+    {
+        // 유효한 메시지 처리
+        bHasReceivedValidMessage = true;
+        ProcessMessage(ReceivedView, Source, ArrivalTime);
+        Offset += ReceivedView.GetEncodedSize();
+    }
 }
 
-void UTimecodeNetworkManager::ProcessMessage(const FTimecodeNetworkMessage& Message)
+void UTimecodeNetworkManager::ProcessMessage(const FTimecodeMessageView& Message, const FIPv4Endpoint& Source, double ArrivalTime)
 {
     // 로그 추가
-    UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Processing message - Type: %d, SenderID: %s"),
-        (int32)Message.MessageType, *Message.SenderID);
+    UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Processing message - Type: %d, SenderID: %08X"),
+        (int32)Message.MessageType, Message.SenderID);
 
     // 안전 검사
     if (bIsShuttingDown || !IsValid(this))
@@ -734,50 +1110,122 @@ void UTimecodeNetworkManager::ProcessMessage(const FTimecodeNetworkMessage& Mess
         return;
     }
 
+    // 시퀀스 검사 - 중복 패킷과 늦게 도착한 동기 패킷은 PLL에 도달하기 전에 버림
+    // (이벤트/명령은 늦더라도 유효하므로 중복만 제거)
+    if (Message.Sequence != 0)
+    {
+        const ETimecodeSequenceResult SequenceResult = CheckSequence(Message);
+        if (SequenceResult == ETimecodeSequenceResult::Duplicate)
+        {
+            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Dropping duplicate packet %u from %08X"),
+                Message.Sequence, Message.SenderID);
+            return;
+        }
+
+        if (SequenceResult == ETimecodeSequenceResult::Reordered &&
+            Message.MessageType != ETimecodeMessageType::Event &&
+            Message.MessageType != ETimecodeMessageType::Command)
+        {
+            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Dropping stale packet %u from %08X"),
+                Message.Sequence, Message.SenderID);
+            return;
+        }
+    }
+
+    // 델리게이트용 문자열 메시지는 바인딩된 경우에만 생성
+    const bool bNeedsMessage = OnMessageReceived.IsBound() ||
+        (Message.MessageType == ETimecodeMessageType::TimecodeSync && OnTimecodeMessageReceived.IsBound());
+    FTimecodeNetworkMessage FullMessage;
+    if (bNeedsMessage)
+    {
+        Message.ToMessage(FullMessage);
+    }
+
     // 메시지 타입에 따른 처리
     switch (Message.MessageType)
     {
         case ETimecodeMessageType::TimecodeSync:
-            // PLL 업데이트 (마스터 타임코드 수신 시)
-            if (!bIsMasterMode)
-            {
-                // 타임코드 메시지에서 시간 정보 추출
-                double MasterTime = Message.Timestamp;
-                double LocalTime = FPlatformTime::Seconds();
-
-                // PLL 업데이트
-                UpdatePLL(MasterTime, LocalTime);
-            }
+            // PLL은 수신 스레드에서 이미 갱신됨 (UpdateServo)
 
             // 타임코드 메시지 브로드캐스트
-            OnTimecodeMessageReceived.Broadcast(Message);
+            if (OnTimecodeMessageReceived.IsBound())
+            {
+                OnTimecodeMessageReceived.Broadcast(FullMessage);
+            }
             bHasReceivedValidMessage = true;
             break;
 
         case ETimecodeMessageType::Event:
             // 이벤트 메시지 처리
-            UE_LOG(LogTimecodeNetwork, Log, TEXT("Received event: %s at %s"), *Message.Data, *Message.Timecode);
+            UE_LOG(LogTimecodeNetwork, Log, TEXT("Received event: %s at %s"),
+                *Message.GetPayloadString(), *Message.GetTimecodeString());
             break;
 
-        default:
-            UE_LOG(LogTimecodeNetwork, Warning, TEXT("Unknown message type received"));
+        case ETimecodeMessageType::Command:
+            // 탐색/재생 속도 명령 (서보는 수신 스레드에서 이미 옮겨짐 - ApplyTransport)
+            if (!bIsMasterMode && (Message.Flags & TimecodeWire::FlagTransport) != 0)
+            {
+                FTimecodeTransportInfo Transport;
+                if (Transport.Decode(Message))
+                {
+                    // 같은 세대의 재전송과 순서가 바뀐 이전 명령은 전달하지 않음
+                    if (Message.SenderID == TransportSenderID && !Transport.IsNewerThan(TransportGeneration))
+                    {
+                        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Ignoring transport command generation %u (applied %u)"),
+                            Transport.Generation, TransportGeneration);
+                        break;
+                    }
+                    TransportSenderID = Message.SenderID;
+                    TransportGeneration = Transport.Generation;
+
+                    UE_LOG(LogTimecodeNetwork, Log, TEXT("Received transport command: %.3fs -> %.3fs at rate %.2f"),
+                        Transport.PreviousSeconds, Transport.TimecodeSeconds, Transport.PlaybackRate);
+                    OnTransportCommandReceived.Broadcast(Transport.PreviousSeconds, Transport.TimecodeSeconds, static_cast<float>(Transport.PlaybackRate));
+                }
+            }
             break;
-    }
 
-    switch (Message.MessageType)
-    {
-    case ETimecodeMessageType::TimecodeSync:
-        // 처리 코드...
-        break;
-    case ETimecodeMessageType::Heartbeat:
-        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Received heartbeat from %s"), *Message.SenderID);
-        // 하트비트 처리...
-        break;
-    default:
-        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Unknown message type received: %d"), (int32)Message.MessageType);
-        break;
-    }
-}
+        case ETimecodeMessageType::Heartbeat:
+            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Received heartbeat from %08X"), Message.SenderID);
+            if (IsElectionActive() && Message.SenderID != InstanceNumericID)
+            {
+                FTimecodeElectionInfo Info;
+                if (Info.Decode(Message))
+                {
+                    Election.Observe(Message.SenderID, Info, FPlatformTime::Seconds());
+                }
+            }
+            break;
+
+        case ETimecodeMessageType::DelayRequest:
+        case ETimecodeMessageType::DelayResponse:
+            // 수신 스레드에서 이미 처리됨 (HandleTimingMessage)
+            break;
+
+        case ETimecodeMessageType::Join:
+            // 슬레이브 등록/생존 갱신 (발신지 엔드포인트로 직접 전송)
+            if (bIsMasterMode || bIsRelayMode)
+            {
+                FScopeLock RegistryLock(&SlaveRegistryLock);
+                if (SlaveRegistry.Register(Message.SenderID, Source, FPlatformTime::Seconds()))
+                {
+                    UE_LOG(LogTimecodeNetwork, Log, TEXT("Slave %08X joined from %s (%d registered)"),
+                        Message.SenderID, *Source.ToString(), SlaveRegistry.Num());
+                }
+            }
+            break;
+
+        default:
+            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Unhandled message type received: %d"), (int32)Message.MessageType);
+            break;
+    }
+
+    // 델리게이트 호출 전 유효성 검사
+    if (IsValid(this) && !bIsShuttingDown && OnMessageReceived.IsBound())
+    {
+        OnMessageReceived.Broadcast(FullMessage);
+    }
+}
 
 void UTimecodeNetworkManager::SetConnectionState(ENetworkConnectionState NewState)
 {
@@ -897,6 +1345,179 @@ bool UTimecodeNetworkManager::IsMaster() const
     return bIsMasterMode;
 }
 
+void UTimecodeNetworkManager::SetRelayMode(bool bEnable)
+{
+    if (bIsRelayMode == bEnable)
+    {
+        return;
+    }
+
+    bIsRelayMode = bEnable;
+    UE_LOG(LogTimecodeNetwork, Log, TEXT("Relay mode %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+
+    // 역할이 바뀌므로 이미 초기화된 경우 재초기화
+    if (Socket != nullptr)
+    {
+        const int32 OldPort = ReceivePortNumber;
+        Shutdown();
+        Initialize(bIsMasterMode, OldPort);
+    }
+}
+
+bool UTimecodeNetworkManager::IsRelay() const
+{
+    return bIsRelayMode;
+}
+
+bool UTimecodeNetworkManager::IsElectionActive() const
+{
+    return bElectionEnabled && RoleMode == ETimecodeRoleMode::Automatic && !bIsRelayMode;
+}
+
+void UTimecodeNetworkManager::RunElection()
+{
+    const double Now = FPlatformTime::Seconds();
+
+    FTimecodeElectionInfo Info = LocalElectionInfo;
+    Info.bIsMaster = bIsMasterMode;
+    Info.UptimeSeconds = static_cast<uint32>(Now - CreationTime);
+
+    // 후보 정리는 항상 수행하되, 대기 기간에는 기존 마스터를 따르는 것 외에 스스로 승격하지 않음
+    const uint32 Winner = Election.Elect(InstanceNumericID, Info, Now, ElectionTimeout);
+    if (Winner == InstanceNumericID && Now < ElectionListenUntil)
+    {
+        return;
+    }
+
+    if (Winner != ElectedMasterID)
+    {
+        UE_LOG(LogTimecodeNetwork, Log, TEXT("Elected master: %08X (%d candidates heard)"), Winner, Election.NumCandidates());
+        ElectedMasterID = Winner;
+    }
+
+    const bool bShouldBeMaster = Winner == InstanceNumericID;
+    if (bShouldBeMaster != bIsMasterMode)
+    {
+        ApplyElectedRole(bShouldBeMaster);
+    }
+}
+
+void UTimecodeNetworkManager::ApplyElectedRole(bool bBecomeMaster)
+{
+    UE_LOG(LogTimecodeNetwork, Log, TEXT("Master election: %s"),
+        bBecomeMaster ? TEXT("taking over as MASTER") : TEXT("stepping down to SLAVE"));
+
+    // 소켓은 그대로 두고 역할만 전환 (수신 스레드는 다음 패킷부터 새 역할을 따름)
+    // 승격된 노드의 서보 스냅샷은 더 이상 갱신되지 않으므로 GetServedTime이 마지막 시간축을 이어서 사용
+    bIsMasterMode = bBecomeMaster;
+    bRoleAutomaticallyDetermined = true;
+    {
+        FScopeLock RegistryLock(&SlaveRegistryLock);
+        SlaveRegistry.Reset();
+    }
+    JoinTimer = 0.0f;
+    DelayRequestTimer = 0.0f;
+
+    if (bBecomeMaster)
+    {
+        // 슬레이브들이 바로 새 마스터를 후보로 보도록 즉시 알림
+        SendHeartbeat();
+    }
+
+    OnElectedRoleChanged.Broadcast(bBecomeMaster);
+}
+
+void UTimecodeNetworkManager::SetMasterElection(bool bEnable)
+{
+    if (bElectionEnabled == bEnable)
+    {
+        return;
+    }
+
+    bElectionEnabled = bEnable;
+    Election.Reset();
+    ElectedMasterID = 0;
+    ElectionListenUntil = FPlatformTime::Seconds() + ElectionTimeout;
+
+    UE_LOG(LogTimecodeNetwork, Log, TEXT("Master election %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+}
+
+bool UTimecodeNetworkManager::IsMasterElectionEnabled() const
+{
+    return bElectionEnabled;
+}
+
+void UTimecodeNetworkManager::SetElectionPriority(int32 Priority, int32 InClockQuality)
+{
+    LocalElectionInfo.Priority = static_cast<uint8>(FMath::Clamp(Priority, 0, 255));
+    LocalElectionInfo.ClockQuality = static_cast<uint8>(FMath::Clamp(InClockQuality, 0, 255));
+}
+
+FString UTimecodeNetworkManager::GetElectedMasterID() const
+{
+    return ElectedMasterID != 0 ? FString::Printf(TEXT("%08X"), ElectedMasterID) : FString();
+}
+
+double UTimecodeNetworkManager::GetServedTime(double LocalTime) const
+{
+    const FTimecodeServoSnapshot Snapshot = ServoSnapshot.Load();
+    return Snapshot.IsValid() ? Snapshot.GetMasterTime(LocalTime) : LocalTime;
+}
+
+void UTimecodeNetworkManager::ForwardDownstream(const FTimecodeMessageView& Message, double ArrivalTime)
+{
+    if (Message.MessageType != ETimecodeMessageType::TimecodeSync &&
+        Message.MessageType != ETimecodeMessageType::Event &&
+        Message.MessageType != ETimecodeMessageType::Command &&
+        Message.MessageType != ETimecodeMessageType::Heartbeat)
+    {
+        return;
+    }
+
+    // 하위 슬레이브가 보낸 메시지는 되돌려 보내지 않음 (게임 스레드가 등록/제거하는 동안 잠금)
+    FScopeLock RegistryLock(&SlaveRegistryLock);
+    if (SlaveRegistry.Num() == 0 || SlaveRegistry.Contains(Message.SenderID))
+    {
+        return;
+    }
+
+    // 중복/늦은 패킷은 재전송하지 않음 (이벤트/명령은 늦더라도 유효하므로 중복만 제거)
+    if (Message.Sequence != 0)
+    {
+        FTimecodeSenderSequenceState& State = RelaySequences.FindOrAdd(Message.SenderID);
+        const ETimecodeSequenceResult SequenceResult = State.Window.Check(Message.Sequence, State.Stats);
+        if (SequenceResult == ETimecodeSequenceResult::Duplicate ||
+            (SequenceResult == ETimecodeSequenceResult::Reordered &&
+                Message.MessageType != ETimecodeMessageType::Event &&
+                Message.MessageType != ETimecodeMessageType::Command))
+        {
+            return;
+        }
+    }
+
+    // 원래 송신자 ID와 시퀀스를 유지하므로 하위 슬레이브는 상위 마스터를 동기 소스로 봄
+    FTimecodeMessageView Forwarded = Message;
+    uint8 CorrectionStorage[TimecodeWire::CorrectionSize];
+    uint8 Buffer[TimecodeWire::MaxMessageSize];
+
+    if (Message.MessageType == ETimecodeMessageType::TimecodeSync)
+    {
+        // 투명 클럭처럼 상위 구간 단방향 지연과 이 노드의 체류 시간(마스터 시간축)을 보정값에 누적
+        const FTimecodeServoSnapshot Upstream = ServoSnapshot.Load();
+        const double UpstreamDelay = bLatencyCompensation ? Upstream.RoundTripDelay * 0.5 : 0.0;
+        const double Residence = (FPlatformTime::Seconds() - ArrivalTime) * Upstream.Frequency;
+        Forwarded.SetCorrection(Message.GetCorrection() + UpstreamDelay + Residence, CorrectionStorage);
+    }
+
+    const int32 Size = Forwarded.Encode(Buffer);
+    const TArrayView<const FInternetAddr* const> Destinations = SlaveRegistry.GetDestinations();
+    const int32 SentCount = SendToMany(TArrayView<const uint8>(Buffer, Size), Destinations);
+    if (SentCount < Destinations.Num())
+    {
+        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Relay reached %d of %d slaves"), SentCount, Destinations.Num());
+    }
+}
+
 bool UTimecodeNetworkManager::TestPacketLossHandling(float SimulatedPacketLossRate)
 {
     // 테스트 결과 초기화
@@ -1031,6 +1652,7 @@ void UTimecodeNetworkManager::SetTargetPort(int32 Port)
 {
     // Set the port number to which outgoing messages will be sent
     SendPortNumber = Port;
+    InvalidateEndpoints();
     UE_LOG(LogTimecodeNetwork, Log, TEXT("Target send port set to: %d"), SendPortNumber);
 }
 
@@ -1039,15 +1661,25 @@ int32 UTimecodeNetworkManager::GetTargetPort() const
     return SendPortNumber;  // 이름 변경
 }
 
+void UTimecodeNetworkManager::SetFrameRate(float InFrameRate)
+{
+    if (InFrameRate > 0.0f)
+    {
+        TimecodeFrameRate = InFrameRate;
+    }
+}
+
+float UTimecodeNetworkManager::GetFrameRate() const
+{
+    return TimecodeFrameRate;
+}
+
 void UTimecodeNetworkManager::SetUsePLL(bool bInUsePLL)
 {
     bUsePLL = bInUsePLL;
 
-    if (bUsePLL)
-    {
-        // PLL 다시 초기화
-        InitializePLL();
-    }
+    // PLL 상태는 수신 스레드 소유이므로 다음 샘플에서 재초기화하도록 요청
+    bServoResetRequested = true;
 
     UE_LOG(LogTimecodeNetwork, Log, TEXT("PLL %s"), bUsePLL ? TEXT("enabled") : TEXT("disabled"));
 }
@@ -1059,7 +1691,7 @@ void UTimecodeNetworkManager::SetPLLParameters(float Bandwidth, float Damping)
     PLLDamping = FMath::Clamp(Damping, 0.1f, 2.0f);
 
     UE_LOG(LogTimecodeNetwork, Log, TEXT("PLL parameters set - Bandwidth: %.3f, Damping: %.3f"),
-        PLLBandwidth, PLLDamping);
+        PLLBandwidth.load(), PLLDamping.load());
 }
 
 bool UTimecodeNetworkManager::GetUsePLL() const
@@ -1075,9 +1707,512 @@ void UTimecodeNetworkManager::GetPLLParameters(float& OutBandwidth, float& OutDa
 
 void UTimecodeNetworkManager::GetPLLStatus(double& OutPhase, double& OutFrequency, double& OutOffset) const
 {
-    OutPhase = PLLPhase;
-    OutFrequency = PLLFrequency;
-    OutOffset = PLLOffset;
+    // 수신 스레드 소유 상태 대신 게시된 스냅샷을 읽음
+    const FTimecodeServoSnapshot Snapshot = ServoSnapshot.Load();
+    OutPhase = Snapshot.Phase;
+    OutFrequency = Snapshot.Frequency;
+    OutOffset = Snapshot.Offset;
+}
+
+FTimecodeClockFilterStats UTimecodeNetworkManager::GetClockFilterStats() const
+{
+    return ServoSnapshot.Load().FilterStats;
+}
+
+void UTimecodeNetworkManager::SetClockFilterMode(ETimecodeClockFilterMode NewMode)
+{
+    ClockFilterMode = NewMode;
+}
+
+ETimecodeClockFilterMode UTimecodeNetworkManager::GetClockFilterMode() const
+{
+    return ClockFilterMode;
+}
+
+FTimecodeServoSnapshot UTimecodeNetworkManager::GetServoSnapshot() const
+{
+    return ServoSnapshot.Load();
+}
+
+FTimecodeHoldoverStatus UTimecodeNetworkManager::GetHoldoverStatus() const
+{
+    FTimecodeHoldoverStatus Status;
+
+    // 마스터는 기준 클럭이므로 홀드오버 없음
+    if (bIsMasterMode)
+    {
+        Status.State = ETimecodeSyncState::Locked;
+        return Status;
+    }
+
+    const FTimecodeServoSnapshot Snapshot = ServoSnapshot.Load();
+    if (!Snapshot.IsValid())
+    {
+        return Status;
+    }
+
+    // 마지막 샘플 이후 경과 시간 동안 학습된 위상/주파수 오차가 누적됨
+    FTimecodeHoldoverModel Model;
+    Model.PhaseJitter = Snapshot.PhaseJitter;
+    Model.FrequencyError = Snapshot.FrequencyError;
+
+    const double Age = FPlatformTime::Seconds() - Snapshot.LocalTime;
+    Status.Frequency = Snapshot.Frequency;
+    Status.SlewRemaining = Snapshot.SlewRemaining;
+    Status.Uncertainty = Model.GetUncertainty(Age) + FMath::Abs(Snapshot.SlewRemaining);
+
+    if (Age > HoldoverThreshold)
+    {
+        Status.State = ETimecodeSyncState::Holdover;
+        Status.HoldoverDuration = Age;
+    }
+    else
+    {
+        Status.State = Snapshot.SlewRemaining != 0.0 ? ETimecodeSyncState::Recovering : ETimecodeSyncState::Locked;
+    }
+
+    return Status;
+}
+
+void UTimecodeNetworkManager::SetHoldoverParameters(float Threshold, float MaxSlewPPM)
+{
+    HoldoverThreshold = FMath::Clamp(Threshold, 0.1f, 10.0f);
+    MaxSlewRate = FMath::Clamp(MaxSlewPPM, 1.0f, 100000.0f) * 1e-6;
+}
+
+void UTimecodeNetworkManager::UpdateServo(const FTimecodeMessageView& Message, double ArrivalTime)
+{
+    // 게임 스레드의 재초기화 요청 처리
+    if (bServoResetRequested.exchange(false))
+    {
+        InitializePLL();
+    }
+
+    // 동기를 보내는 마스터가 바뀌면 필터를 새로 시작
+    if (Message.SenderID != ServoSenderID)
+    {
+        // 선출로 승격된 마스터는 이전 마스터의 시간축을 이어서 보내므로, 예측과 맞으면
+        // 학습된 주파수와 위상을 유지한 채 인계 (PLL 재시작에 의한 위상 점프 없음)
+        constexpr double HandoverTolerance = 0.05;
+        const FTimecodeServoSnapshot Current = ServoSnapshot.Load();
+        const bool bContinuous = ServoSenderID != 0 && Current.IsValid() &&
+            FMath::Abs(Message.Timestamp + Message.GetCorrection() - Current.GetMasterTime(ArrivalTime)) < HandoverTolerance;
+
+        if (ServoSenderID != 0)
+        {
+            UE_LOG(LogTimecodeNetwork, Log, TEXT("Sync source changed from %08X to %08X, %s"),
+                ServoSenderID, Message.SenderID, bContinuous ? TEXT("handing over servo") : TEXT("restarting servo"));
+        }
+        ServoSenderID = Message.SenderID;
+        ServoSequenceWindow.Reset();
+        ServoTransportGeneration = 0;
+        ServoRoundTripDelay = 0.0;
+        ServoMeasuredOffset = 0.0;
+        ClockFilter.Reset();
+        if (!bContinuous)
+        {
+            InitializePLL();
+        }
+    }
+
+    // 늦게 도착했거나 중복된 샘플은 서보에 넣지 않음
+    if (Message.Sequence != 0 &&
+        ServoSequenceWindow.Check(Message.Sequence, ServoSequenceStats) != ETimecodeSequenceResult::InOrder)
+    {
+        return;
+    }
+
+    const FTimecodeServoSnapshot Previous = ServoSnapshot.Load();
+    FTimecodeServoSnapshot Snapshot;
+    Snapshot.RoundTripDelay = ServoRoundTripDelay;
+    Snapshot.MeasuredOffset = ServoMeasuredOffset;
+    Snapshot.FilterStats = ClockFilter.GetStats();
+
+    // 홀드오버 후 첫 샘플: 그동안의 간격은 PLL 입력으로 쓰지 않음 (학습된 주파수 유지)
+    const bool bHoldoverEnded = Previous.IsValid() && ArrivalTime - Previous.LocalTime > HoldoverThreshold;
+
+    // 왕복 측정이 있으면 클럭 필터가 고른(큐잉 지연이 가장 적은) 오프셋을 도착 시각까지 외삽해 서보에 넣음
+    // (개별 동기 샘플의 큐잉 지연 잡음은 PLL에 들어가지 않고, 동기 샘플은 갱신 시점과 타임코드만 제공)
+    // 측정 전에는 마스터 송신 시각에 릴레이가 더한 보정(상위 경로 지연 + 체류 시간)과
+    // 마지막 구간의 단방향 경로 지연(왕복의 절반)을 더해 도착 시점의 마스터 시각으로 보정
+    const bool bUseFilteredOffset = bLatencyCompensation && ClockFilter.HasEstimate();
+    const double MasterTime = bUseFilteredOffset ?
+        ArrivalTime + ClockFilter.GetOffsetAt(ArrivalTime, bUsePLL ? PLLFrequency : 1.0) :
+        Message.Timestamp + Message.GetCorrection() + (bLatencyCompensation ? ServoRoundTripDelay * 0.5 : 0.0);
+
+    if (bUsePLL)
+    {
+        if (bHoldoverEnded)
+        {
+            UE_LOG(LogTimecodeNetwork, Log, TEXT("Sync resumed after %.2fs holdover, re-converging"), ArrivalTime - Previous.LocalTime);
+            LastMasterTimestamp = MasterTime;
+            LastLocalTimestamp = ArrivalTime;
+            bServoSlewing = true;
+        }
+        else
+        {
+            const double PreviousFrequency = PLLFrequency;
+            UpdatePLL(MasterTime, ArrivalTime);
+
+            // 잠금 상태의 샘플만 오차 모델에 반영
+            if (!bServoSlewing)
+            {
+                HoldoverModel.AddSample(PLLLastPhaseError, PLLFrequency - PreviousFrequency);
+            }
+        }
+
+        Snapshot.MasterTime = LastMasterTimestamp;
+        Snapshot.LocalTime = LastLocalTimestamp;
+        Snapshot.Phase = PLLPhase;
+        Snapshot.Frequency = PLLFrequency;
+        Snapshot.Offset = PLLOffset;
+    }
+    else
+    {
+        // PLL 비활성화 - 마지막 샘플을 그대로 사용
+        Snapshot.MasterTime = MasterTime;
+        Snapshot.LocalTime = ArrivalTime;
+        Snapshot.Offset = MasterTime - ArrivalTime;
+    }
+
+    Snapshot.PlaybackRate = ServoPlaybackRate;
+    Snapshot.TimecodeSeconds = Message.HasTimecode() ? Message.GetTimecodeSeconds() :
+        (Previous.IsValid() ? Previous.GetTimecodeSeconds(Snapshot.LocalTime) : 0.0);
+
+    // 복귀 중: 게시된 시간축을 계단 없이 제한된 속도로 마스터에 맞춤 (PLL 자체는 마스터를 그대로 추적)
+    if (bServoSlewing && bUsePLL && Previous.IsValid())
+    {
+        const double Published = Previous.GetMasterTime(ArrivalTime);
+        const double Error = Snapshot.MasterTime - Published;
+        if (FMath::Abs(Error) > FTimecodeHoldoverModel::SlewExitThreshold &&
+            FMath::Abs(Error) < FTimecodeHoldoverModel::SlewStepThreshold)
+        {
+            Snapshot.MasterTime = Published;
+            Snapshot.LocalTime = ArrivalTime;
+            Snapshot.Frequency = PLLFrequency + FTimecodeHoldoverModel::GetSlewFrequency(Error, MaxSlewRate);
+            Snapshot.TimecodeSeconds = Previous.GetTimecodeSeconds(ArrivalTime);
+            Snapshot.SlewRemaining = Error;
+        }
+        else
+        {
+            if (FMath::Abs(Error) >= FTimecodeHoldoverModel::SlewStepThreshold)
+            {
+                UE_LOG(LogTimecodeNetwork, Warning, TEXT("Holdover error %.1fms too large to slew, stepping"), Error * 1000.0);
+            }
+            bServoSlewing = false;
+        }
+    }
+
+    Snapshot.PhaseJitter = HoldoverModel.PhaseJitter;
+    Snapshot.FrequencyError = HoldoverModel.FrequencyError;
+
+    ServoSnapshot.Store(Snapshot);
+}
+
+void UTimecodeNetworkManager::ApplyTransport(const FTimecodeMessageView& Message, double ArrivalTime)
+{
+    // 현재 동기 소스(마스터)의 명령만, 세대마다 한 번 적용 (재전송과 순서가 바뀌어 늦게 온 이전 명령은 무시)
+    FTimecodeTransportInfo Transport;
+    if ((ServoSenderID != 0 && Message.SenderID != ServoSenderID) || !Transport.Decode(Message) ||
+        !Transport.IsNewerThan(ServoTransportGeneration))
+    {
+        return;
+    }
+
+    ServoTransportGeneration = Transport.Generation;
+    ServoPlaybackRate = Transport.PlaybackRate;
+
+    // 동기 샘플을 기다리지 않고 게시된 타임코드를 바로 옮김 (PLL 상태는 마스터 벽시계 기준이라 그대로 유지)
+    FTimecodeServoSnapshot Snapshot = ServoSnapshot.Load();
+    if (Snapshot.IsValid())
+    {
+        const double MasterTime = Message.Timestamp + (bLatencyCompensation ? ServoRoundTripDelay * 0.5 : 0.0);
+        Snapshot.Rebase(MasterTime, Transport.TimecodeSeconds, Transport.PlaybackRate);
+        ServoSnapshot.Store(Snapshot);
+    }
+}
+
+void UTimecodeNetworkManager::HandleTimingMessage(const FTimecodeMessageView& Message, double ArrivalTime, const FIPv4Endpoint& Source)
+{
+    switch (Message.MessageType)
+    {
+        case ETimecodeMessageType::TimecodeSync:
+            if (!bIsMasterMode)
+            {
+                UpdateServo(Message, ArrivalTime);
+            }
+            break;
+
+        case ETimecodeMessageType::DelayRequest:
+            if (bIsMasterMode || bIsRelayMode)
+            {
+                HandleDelayRequest(Message, ArrivalTime, Source);
+            }
+            break;
+
+        case ETimecodeMessageType::DelayResponse:
+            if (!bIsMasterMode)
+            {
+                HandleDelayResponse(Message, ArrivalTime);
+            }
+            break;
+
+        case ETimecodeMessageType::Command:
+            if (!bIsMasterMode && (Message.Flags & TimecodeWire::FlagTransport) != 0)
+            {
+                ApplyTransport(Message, ArrivalTime);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool UTimecodeNetworkManager::SendDelayRequest()
+{
+    if (Socket == nullptr || ConnectionState != ENetworkConnectionState::Connected)
+    {
+        return false;
+    }
+
+    FTimecodeMessageView Request;
+    Request.MessageType = ETimecodeMessageType::DelayRequest;
+    Request.SenderID = InstanceNumericID;
+    Request.Sequence = AllocateSequence();
+    Request.Timestamp = FPlatformTime::Seconds(); // t1
+
+    // 이전 요청의 응답은 더 이상 받지 않음 (응답의 t1과 일치해야 함)
+    PendingDelayRequestTime.store(Request.Timestamp);
+
+    uint8 Buffer[TimecodeWire::HeaderSize];
+    const int32 Size = Request.Encode(Buffer);
+
+    // 배치와 무관하게 즉시 전송 (t1이 실제 송신 시각에 가깝도록)
+    return SendDatagram(TArrayView<const uint8>(Buffer, Size));
+}
+
+void UTimecodeNetworkManager::HandleDelayRequest(const FTimecodeMessageView& Message, double ArrivalTime, const FIPv4Endpoint& Source)
+{
+    // 릴레이는 상위 마스터를 대신해 마스터 시간축으로 응답 (하위 슬레이브의 동기 소스 ID가 상위 마스터이므로)
+    const bool bAnswerForUpstream = !bIsMasterMode && bIsRelayMode;
+    if (bAnswerForUpstream && (ServoSenderID == 0 || !ServoSnapshot.Load().IsValid()))
+    {
+        return; // 아직 상위 마스터에 동기화되지 않음
+    }
+
+    // 슬레이브별 응답 빈도 제한 (요청 주기의 절반보다 잦은 요청은 무시)
+    const double RateLimitWindow = DelayRequestInterval * 0.5;
+
+    // 제한 구간이 지난 항목은 판정에 영향이 없으므로 요청 주기마다 정리
+    if (ArrivalTime - DelayResponsePruneTime >= DelayRequestInterval)
+    {
+        for (auto It = DelayResponseTimes.CreateIterator(); It; ++It)
+        {
+            if (ArrivalTime - It.Value() >= RateLimitWindow)
+            {
+                It.RemoveCurrent();
+            }
+        }
+        DelayResponsePruneTime = ArrivalTime;
+    }
+
+    double& LastResponseTime = DelayResponseTimes.FindOrAdd(Message.SenderID, 0.0);
+    if (ArrivalTime - LastResponseTime < RateLimitWindow)
+    {
+        UE_LOG(LogTimecodeNetwork, VeryVerbose, TEXT("Delay request from %08X rate limited"), Message.SenderID);
+        return;
+    }
+    LastResponseTime = ArrivalTime;
+
+    FTimecodeDelayResponse Response;
+    Response.RequesterID = Message.SenderID;
+    Response.RequestTime = Message.Timestamp; // t1
+    Response.ReceiveTime = GetServedTime(ArrivalTime); // t2 (선출로 승격된 마스터와 릴레이는 이어받은 시간축)
+
+    uint8 Payload[FTimecodeDelayResponse::PayloadSize];
+    FTimecodeMessageView Reply;
+    Reply.MessageType = ETimecodeMessageType::DelayResponse;
+    Reply.SenderID = bAnswerForUpstream ? ServoSenderID : InstanceNumericID;
+    Reply.Payload = Payload;
+    Reply.PayloadLength = static_cast<uint16>(Response.Encode(Payload));
+
+    // 요청 발신지로 바로 응답 (게임 스레드 소유의 주소 캐시를 건드리지 않음)
+    const TSharedRef<FInternetAddr> Destination = Source.ToInternetAddr();
+
+    uint8 Buffer[TimecodeWire::HeaderSize + FTimecodeDelayResponse::PayloadSize];
+    Reply.Timestamp = GetServedTime(FPlatformTime::Seconds()); // t3
+    const int32 Size = Reply.Encode(Buffer);
+
+    int32 BytesSent = 0;
+    if (!SendRaw(TArrayView<const uint8>(Buffer, Size), *Destination, BytesSent))
+    {
+        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Failed to answer delay request from %s"), *Source.ToString());
+    }
+}
+
+void UTimecodeNetworkManager::HandleDelayResponse(const FTimecodeMessageView& Message, double ArrivalTime)
+{
+    FTimecodeDelayResponse Response;
+    if (!Response.Decode(Message) || Response.RequesterID != InstanceNumericID)
+    {
+        return;
+    }
+
+    // 동기를 보내는 마스터의 응답만 반영 (다른 노드의 응답이 대기 중인 요청을 소비하지 않도록 먼저 확인)
+    if (ServoSenderID != 0 && Message.SenderID != ServoSenderID)
+    {
+        return;
+    }
+
+    // 현재 기다리는 요청에 대한 응답만 한 번 사용 (늦게 온 응답, 중복 응답 무시)
+    double Expected = Response.RequestTime;
+    if (Expected == 0.0 || !PendingDelayRequestTime.compare_exchange_strong(Expected, 0.0))
+    {
+        return;
+    }
+
+    const double RoundTripDelay = Response.GetRoundTripDelay(Message.Timestamp, ArrivalTime);
+    if (RoundTripDelay < 0.0)
+    {
+        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Discarding negative round-trip delay %.3fms"), RoundTripDelay * 1000.0);
+        return;
+    }
+
+    // 큐잉 지연이 적은 샘플을 골라 서보에 전달 (개별 샘플은 큐잉 지연으로 잡음이 큼)
+    const double Offset = Response.GetOffset(Message.Timestamp, ArrivalTime);
+    ClockFilter.Mode = ClockFilterMode.load();
+    ClockFilter.AddSample(Offset, RoundTripDelay, ArrivalTime);
+    ServoRoundTripDelay = ClockFilter.GetDelay();
+    ServoMeasuredOffset = ClockFilter.GetOffset();
+
+    // 다음 동기 샘플을 기다리지 않고 측정값 게시
+    FTimecodeServoSnapshot Snapshot = ServoSnapshot.Load();
+    Snapshot.RoundTripDelay = ServoRoundTripDelay;
+    Snapshot.MeasuredOffset = ServoMeasuredOffset;
+    Snapshot.FilterStats = ClockFilter.GetStats();
+    ServoSnapshot.Store(Snapshot);
+
+    UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Round-trip sample: %.3fms (offset %.3fms), filtered: %.3fms (offset %.3fms, jitter %.3fms)"),
+        RoundTripDelay * 1000.0, Offset * 1000.0, ServoRoundTripDelay * 1000.0, ServoMeasuredOffset * 1000.0,
+        ClockFilter.GetStats().Jitter * 1000.0);
+}
+
+void UTimecodeNetworkManager::SetNetworkLatencyCompensation(bool bEnable)
+{
+    bLatencyCompensation = bEnable;
+    DelayRequestTimer = 0.0f;
+    if (!bEnable)
+    {
+        PendingDelayRequestTime.store(0.0);
+    }
+
+    UE_LOG(LogTimecodeNetwork, Log, TEXT("Network latency compensation %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
+}
+
+bool UTimecodeNetworkManager::IsNetworkLatencyCompensationEnabled() const
+{
+    return bLatencyCompensation;
+}
+
+bool UTimecodeNetworkManager::SendJoin()
+{
+    if (Socket == nullptr || ConnectionState != ENetworkConnectionState::Connected)
+    {
+        return false;
+    }
+
+    FTimecodeMessageView Join;
+    Join.MessageType = ETimecodeMessageType::Join;
+    Join.SenderID = InstanceNumericID;
+    Join.Sequence = AllocateSequence();
+    Join.Timestamp = FPlatformTime::Seconds();
+
+    uint8 Buffer[TimecodeWire::HeaderSize];
+    return QueueOrSend(TArrayView<const uint8>(Buffer, Join.Encode(Buffer)));
+}
+
+void UTimecodeNetworkManager::SetUnicastFanOut(bool bEnable)
+{
+    bUnicastFanOut = bEnable;
+    JoinTimer = 0.0f;
+    if (!bEnable)
+    {
+        FScopeLock RegistryLock(&SlaveRegistryLock);
+        SlaveRegistry.Reset();
+    }
+}
+
+bool UTimecodeNetworkManager::IsUnicastFanOutEnabled() const
+{
+    return bUnicastFanOut;
+}
+
+TArray<FTimecodeSlaveInfo> UTimecodeNetworkManager::GetRegisteredSlaves() const
+{
+    return SlaveRegistry.GetSlaveInfo(FPlatformTime::Seconds());
+}
+
+TArray<FTimecodeSenderStats> UTimecodeNetworkManager::GetSenderStatistics() const
+{
+    TArray<FTimecodeSenderStats> Result;
+    Result.Reserve(SenderSequences.Num());
+    for (const TPair<uint32, FTimecodeSenderSequenceState>& Pair : SenderSequences)
+    {
+        Result.Add(Pair.Value.Stats);
+    }
+    return Result;
+}
+
+void UTimecodeNetworkManager::ResetSenderStatistics()
+{
+    SenderSequences.Empty();
+}
+
+uint32 UTimecodeNetworkManager::AllocateSequence()
+{
+    // 0은 "시퀀스 없음"으로 예약되어 있으므로 랩어라운드 시 건너뜀
+    if (++LastSentSequence == 0)
+    {
+        LastSentSequence = 1;
+    }
+    return LastSentSequence;
+}
+
+ETimecodeSequenceResult UTimecodeNetworkManager::CheckSequence(const FTimecodeMessageView& Message)
+{
+    FTimecodeSenderSequenceState* State = SenderSequences.Find(Message.SenderID);
+    if (State == nullptr)
+    {
+        State = &SenderSequences.Add(Message.SenderID);
+        State->Stats.SenderID = FString::Printf(TEXT("%08X"), Message.SenderID);
+    }
+
+    const int32 PreviousLost = State->Stats.LostCount;
+    const ETimecodeSequenceResult Result = State->Window.Check(Message.Sequence, State->Stats);
+
+    if (State->Stats.LostCount > PreviousLost)
+    {
+        UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sequence gap from %08X: %d packet(s) missing before %u"),
+            Message.SenderID, State->Stats.LostCount - PreviousLost, Message.Sequence);
+    }
+
+    return Result;
+}
+
+void UTimecodeNetworkManager::SetInboxDropPolicy(ETimecodeInboxDropPolicy NewPolicy)
+{
+    Inbox.SetDropPolicy(NewPolicy);
+}
+
+ETimecodeInboxDropPolicy UTimecodeNetworkManager::GetInboxDropPolicy() const
+{
+    return Inbox.GetDropPolicy();
+}
+
+FTimecodeInboxStats UTimecodeNetworkManager::GetInboxStats() const
+{
+    return Inbox.GetStats();
 }
 
 void UTimecodeNetworkManager::InitializePLL()
@@ -1090,6 +2225,13 @@ void UTimecodeNetworkManager::InitializePLL()
     LastMasterTimestamp = 0.0;
     LastLocalTimestamp = 0.0;
 
+    PLLLastPhaseError = 0.0;
+    HoldoverModel.Reset();
+    bServoSlewing = false;
+
+    // 게시된 스냅샷도 초기화 (수신 스레드 또는 수신 스레드 시작 전에만 호출됨)
+    ServoSnapshot.Store(FTimecodeServoSnapshot());
+
     UE_LOG(LogTimecodeNetwork, Log, TEXT("PLL initialized"));
 }
 
@@ -1145,6 +2287,7 @@ void UTimecodeNetworkManager::UpdatePLL(double MasterTime, double LocalTime)
     // PLL 상태 업데이트
     PLLPhase += PhaseError * K1 * DeltaLocal;
     PLLFrequency += PhaseError * K2 * DeltaLocal;
+    PLLLastPhaseError = PhaseError;
 
     // 오프셋 업데이트
     PLLOffset = PLLPhase;
@@ -1174,11 +2317,9 @@ double UTimecodeNetworkManager::GetPLLCorrectedTime(double LocalTime) const
         return LocalTime;
     }
 
-    // PLL 적용된 시간 계산: 로컬 시간에 주파수 비율 적용하고 오프셋 더함
-    double ElapsedSinceLastUpdate = LocalTime - LastLocalTimestamp;
-    double CorrectedTime = LastMasterTimestamp + (ElapsedSinceLastUpdate * PLLFrequency);
-
-    return CorrectedTime;
+    // PLL 적용된 시간 계산: 게시된 스냅샷 기준으로 로컬 시간에 주파수 비율 적용
+    const FTimecodeServoSnapshot Snapshot = ServoSnapshot.Load();
+    return Snapshot.IsValid() ? Snapshot.GetMasterTime(LocalTime) : LocalTime;
 }
 
 void UTimecodeNetworkManager::SetDedicatedMaster(bool bInIsDedicatedMaster)
@@ -1222,51 +2363,22 @@ bool UTimecodeNetworkManager::SendModeChangeCommand(ETimecodeMode NewMode)
         return false;
     }
 
-    // 명령 메시지 생성
-    FTimecodeNetworkMessage Message;
+    // 명령 메시지 생성 (스택 버퍼에 직접 인코딩 - 명령 문자열은 ANSI 페이로드, 타임코드 없음)
+    FTimecodeMessageView Message;
     Message.MessageType = ETimecodeMessageType::Command;
-    Message.Timecode = TEXT("00:00:00:00"); // 기본 타임코드
-    Message.Data = FString::Printf(TEXT("SetMode:%d"), static_cast<int32>(NewMode));
     Message.Timestamp = FPlatformTime::Seconds();
-    Message.SenderID = InstanceID;
+    Message.SenderID = InstanceNumericID;
+    Message.Sequence = AllocateSequence();
 
-    // 메시지 직렬화
-    TArray<uint8> MessageData = Message.Serialize();
+    ANSICHAR Command[32];
+    const int32 CommandLength = FCStringAnsi::Snprintf(Command, UE_ARRAY_COUNT(Command), "SetMode:%d", static_cast<int32>(NewMode));
+    Message.Payload = reinterpret_cast<const uint8*>(Command);
+    Message.PayloadLength = static_cast<uint16>(FMath::Clamp(CommandLength, 0, static_cast<int32>(UE_ARRAY_COUNT(Command)) - 1));
 
-    // 전송 로직 (멀티캐스트 우선, 없으면 타겟 IP, 없으면 마스터 IP)
-    int32 BytesSent = 0;
-    bool bSuccess = false;
+    uint8 Buffer[TimecodeWire::HeaderSize + UE_ARRAY_COUNT(Command)];
 
-    if (!MulticastGroupAddress.IsEmpty())
-    {
-        // 멀티캐스트 그룹으로 전송
-        TSharedRef<FInternetAddr> MulticastAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-        bool bIsValid = false;
-        MulticastAddr->SetIp(*MulticastGroupAddress, bIsValid);
-        if (bIsValid)
-        {
-            MulticastAddr->SetPort(SendPortNumber);  // 올바른 타겟 포트 사용
-            bSuccess = Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *MulticastAddr);
-
-            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent mode change command to multicast group: %s (Port: %d)"),
-                *MulticastGroupAddress, SendPortNumber);
-        }
-    }
-    else if (!TargetIPAddress.IsEmpty())
-    {
-        // 타겟 IP로 전송
-        TSharedRef<FInternetAddr> TargetAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-        bool bIsValid = false;
-        TargetAddr->SetIp(*TargetIPAddress, bIsValid);
-        if (bIsValid)
-        {
-            TargetAddr->SetPort(SendPortNumber);  // 올바른 타겟 포트 사용
-            bSuccess = Socket->SendTo(MessageData.GetData(), MessageData.Num(), BytesSent, *TargetAddr);
-
-            UE_LOG(LogTimecodeNetwork, Verbose, TEXT("Sent mode change command to target: %s (Port: %d)"),
-                *TargetIPAddress, SendPortNumber);
-        }
-    }
+    // 다른 메시지와 같은 경로로 전송 (멀티캐스트, 유니캐스트 팬아웃, 대상 IP; 배치 중이면 같은 데이터그램에)
+    const bool bSuccess = QueueOrSend(TArrayView<const uint8>(Buffer, Message.Encode(Buffer)));
 
     if (bSuccess)
     {
@@ -1280,6 +2392,51 @@ bool UTimecodeNetworkManager::SendModeChangeCommand(ETimecodeMode NewMode)
     }
 }
 
+bool UTimecodeNetworkManager::SendTransportCommand(const FString& Timecode, double PreviousSeconds, double TimecodeSeconds, float PlaybackRate, double SecondsAgo)
+{
+    if (Socket == nullptr || ConnectionState != ENetworkConnectionState::Connected)
+    {
+        UE_LOG(LogTimecodeNetwork, Warning, TEXT("Cannot send transport command: Socket not connected"));
+        return false;
+    }
+
+    // 동기 메시지와 같은 시간축의 타임스탬프 - 슬레이브는 이 시각의 위치로 서보 출력을 옮김
+    LastTransportTimecode = Timecode;
+    LastTransportTimestamp = GetServedTime(FPlatformTime::Seconds() - SecondsAgo);
+    LastTransport.TimecodeSeconds = TimecodeSeconds;
+    LastTransport.PlaybackRate = PlaybackRate;
+    LastTransport.PreviousSeconds = PreviousSeconds;
+
+    // 명령마다 새 세대 (0은 사용하지 않음)
+    if (++LastTransport.Generation == 0)
+    {
+        LastTransport.Generation = 1;
+    }
+    TransportRefreshTimer = 0.0f;
+
+    UE_LOG(LogTimecodeNetwork, Log, TEXT("Sending transport command: %s (%.3fs) at rate %.2f"), *Timecode, TimecodeSeconds, PlaybackRate);
+    return SendLastTransport();
+}
+
+bool UTimecodeNetworkManager::SendLastTransport()
+{
+    FTimecodeMessageView Message;
+    Message.MessageType = ETimecodeMessageType::Command;
+    Message.SetTimecode(LastTransportTimecode, TimecodeFrameRate);
+    Message.Timestamp = LastTransportTimestamp;
+    Message.SenderID = InstanceNumericID;
+    Message.Sequence = AllocateSequence();
+
+    uint8 Payload[FTimecodeTransportInfo::PayloadSize];
+    Message.Flags |= TimecodeWire::FlagTransport;
+    Message.Payload = Payload;
+    Message.PayloadLength = static_cast<uint16>(LastTransport.Encode(Payload));
+
+    // 배치 중이면 같은 틱의 이벤트/동기 메시지와 하나의 데이터그램으로 전송
+    uint8 Buffer[TimecodeWire::HeaderSize + FTimecodeTransportInfo::PayloadSize];
+    return QueueOrSend(TArrayView<const uint8>(Buffer, Message.Encode(Buffer)));
+}
+
 void UTimecodeNetworkManager::Tick(float DeltaTime)
 {
     // 안전 검사
@@ -1294,14 +2451,16 @@ void UTimecodeNetworkManager::Tick(float DeltaTime)
         return;
     }
 
+    // 수신 스레드가 쌓아둔 패킷을 한 번에 처리
+    DrainInbox();
+
     // 연결 상태 확인
     CheckConnectionStatus(DeltaTime);
 
-    // 하트비트 전송 (마스터 모드인 경우)
-    if (bIsMasterMode && ConnectionState == ENetworkConnectionState::Connected)
+    // 하트비트 전송 (마스터 모드, 또는 선출에 참여하는 모든 노드)
+    if ((bIsMasterMode || IsElectionActive()) && ConnectionState == ENetworkConnectionState::Connected)
     {
         // 2초마다 하트비트 전송
-        static float HeartbeatTimer = 0.0f;
         HeartbeatTimer += DeltaTime;
 
         if (HeartbeatTimer >= 2.0f)
@@ -1310,6 +2469,62 @@ void UTimecodeNetworkManager::Tick(float DeltaTime)
             HeartbeatTimer = 0.0f;
         }
     }
+
+    // 마스터: 마지막 탐색/재생 속도 명령을 주기적으로 재전송 (유실된 명령 복구, 슬레이브는 새 세대만 적용)
+    if (bIsMasterMode && LastTransport.Generation != 0 && ConnectionState == ENetworkConnectionState::Connected)
+    {
+        TransportRefreshTimer += DeltaTime;
+        if (TransportRefreshTimer >= TransportRefreshInterval)
+        {
+            SendLastTransport();
+            TransportRefreshTimer = 0.0f;
+        }
+    }
+
+    // 마스터 선출 (하트비트 수신 후 역할 재평가)
+    if (IsElectionActive() && ConnectionState == ENetworkConnectionState::Connected)
+    {
+        RunElection();
+    }
+
+    // 유니캐스트 팬아웃: 슬레이브는 주기적으로 Join, 마스터는 응답 없는 슬레이브 제거 (릴레이는 둘 다)
+    if (bUnicastFanOut && ConnectionState == ENetworkConnectionState::Connected)
+    {
+        if (bIsMasterMode || bIsRelayMode)
+        {
+            int32 Removed = 0;
+            {
+                FScopeLock RegistryLock(&SlaveRegistryLock);
+                Removed = SlaveRegistry.Prune(FPlatformTime::Seconds(), SlaveTimeout);
+            }
+            if (Removed > 0)
+            {
+                UE_LOG(LogTimecodeNetwork, Log, TEXT("Removed %d timed out slaves (%d registered)"), Removed, SlaveRegistry.Num());
+            }
+        }
+
+        if (!bIsMasterMode)
+        {
+            // 연결 직후 한 번, 이후 하트비트와 같은 2초 주기 (타임아웃 안에 여러 번 전송)
+            JoinTimer -= DeltaTime;
+            if (JoinTimer <= 0.0f)
+            {
+                SendJoin();
+                JoinTimer = 2.0f;
+            }
+        }
+    }
+
+    // 왕복 지연 측정 요청 (슬레이브, 지연 보상 활성 시)
+    if (!bIsMasterMode && bLatencyCompensation && ConnectionState == ENetworkConnectionState::Connected)
+    {
+        DelayRequestTimer += DeltaTime;
+        if (DelayRequestTimer >= DelayRequestInterval)
+        {
+            SendDelayRequest();
+            DelayRequestTimer = 0.0f;
+        }
+    }
 }
 
 // 연결 상태 확인 함수
@@ -1332,7 +2547,8 @@ void UTimecodeNetworkManager::CheckConnectionStatus(float DeltaTime)
     }
 
     // 매우 간단한 슬레이브 연결 체크로 단순화
-    if (!bIsMasterMode && ConnectionState == ENetworkConnectionState::Connected)
+    // 선출 참여 노드는 마스터가 조용해져도 연결을 유지해야 RunElection이 대기 노드를 승격할 수 있음
+    if (!bIsMasterMode && !IsElectionActive() && ConnectionState == ENetworkConnectionState::Connected)
     {
         FTimespan TimeSinceLastMessage = FDateTime::Now() - LastMessageTime;
         if (TimeSinceLastMessage.GetTotalSeconds() > 15.0)
@@ -1372,10 +2588,26 @@ bool UTimecodeNetworkManager::AttemptReconnection()
         delete Receiver;
         Receiver = nullptr;
     }
+    CloseNativeSocket();
 
     // 소켓 다시 생성
+    OpenNativeSocket();
     if (CreateSocket())
     {
+        if (NativeSocket)
+        {
+            if (StartNativeSocket())
+            {
+                UE_LOG(LogTimecodeNetwork, Log, TEXT("Socket reopened successfully during reconnection attempt"));
+                return true;
+            }
+
+            // 송신 전용 소켓으로는 FUdpSocketReceiver 폴백이 불가능하므로 다음 재시도에 맡김
+            CloseNativeSocket();
+            UE_LOG(LogTimecodeNetwork, Warning, TEXT("Reconnection attempt failed - native socket receive thread did not start"));
+            return false;
+        }
+
         // UDP 수신기 재설정
         FTimespan ThreadWaitTime = FTimespan::FromMilliseconds(100);
         Receiver = new FUdpSocketReceiver(Socket, ThreadWaitTime, TEXT("TimecodeReceiver"));
@@ -1,55 +1,729 @@
 ﻿#include "TimecodeNetworkTypes.h"
+#include "TimecodeValue.h"
+#include "Misc/Crc.h"
+#include "IPAddress.h"
 
-TArray<uint8> FTimecodeNetworkMessage::Serialize() const
+namespace
 {
-    TArray<uint8> Result;
+    struct FWireRateEntry
+    {
+        ETimecodeWireRate Rate;
+        double FrameRate;
+    };
 
-    // Reserve adequate space for the data
-    Result.Reserve(256);
+    // Standard rates that have a wire id
+    constexpr FWireRateEntry WireRates[] =
+    {
+        { ETimecodeWireRate::Fps23_976, 24000.0 / 1001.0 },
+        { ETimecodeWireRate::Fps24, 24.0 },
+        { ETimecodeWireRate::Fps25, 25.0 },
+        { ETimecodeWireRate::Fps29_97, 30000.0 / 1001.0 },
+        { ETimecodeWireRate::Fps30, 30.0 },
+        { ETimecodeWireRate::Fps47_952, 48000.0 / 1001.0 },
+        { ETimecodeWireRate::Fps48, 48.0 },
+        { ETimecodeWireRate::Fps50, 50.0 },
+        { ETimecodeWireRate::Fps59_94, 60000.0 / 1001.0 },
+        { ETimecodeWireRate::Fps60, 60.0 },
+        { ETimecodeWireRate::Fps100, 100.0 },
+        { ETimecodeWireRate::Fps119_88, 120000.0 / 1001.0 },
+        { ETimecodeWireRate::Fps120, 120.0 },
+        { ETimecodeWireRate::Fps240, 240.0 },
+    };
 
-    // Serialize message type
-    uint8 TypeValue = static_cast<uint8>(MessageType);
-    Result.Add(TypeValue);
+    // Big-endian field writers/readers
+    FORCEINLINE void WriteU16(uint8* Out, uint16 Value)
+    {
+        Out[0] = static_cast<uint8>(Value >> 8);
+        Out[1] = static_cast<uint8>(Value);
+    }
 
-    // Serialize timecode
-    FTCHARToUTF8 TimecodeUtf8(*Timecode);
-    uint16 TimecodeLength = static_cast<uint16>(TimecodeUtf8.Length());
-    Result.Add(TimecodeLength & 0xFF);
-    Result.Add((TimecodeLength >> 8) & 0xFF);
-    Result.Append((uint8*)TimecodeUtf8.Get(), TimecodeUtf8.Length());
-    // Add null terminator
-    Result.Add(0);
+    FORCEINLINE void WriteU32(uint8* Out, uint32 Value)
+    {
+        for (int32 i = 0; i < 4; ++i)
+        {
+            Out[i] = static_cast<uint8>(Value >> ((3 - i) * 8));
+        }
+    }
 
-    // Serialize data
-    FTCHARToUTF8 DataUtf8(*Data);
-    uint16 DataLength = static_cast<uint16>(DataUtf8.Length());
-    Result.Add(DataLength & 0xFF);
-    Result.Add((DataLength >> 8) & 0xFF);
-    Result.Append((uint8*)DataUtf8.Get(), DataUtf8.Length());
-    // Add null terminator
-    Result.Add(0);
-
-    // Serialize timestamp (network byte order)
-    uint64 NetworkTimestamp;
-    FMemory::Memcpy(&NetworkTimestamp, &Timestamp, sizeof(double));
-    for (int32 i = 0; i < sizeof(double); ++i)
+    FORCEINLINE void WriteU64(uint8* Out, uint64 Value)
+    {
+        for (int32 i = 0; i < 8; ++i)
+        {
+            Out[i] = static_cast<uint8>(Value >> ((7 - i) * 8));
+        }
+    }
+
+    FORCEINLINE uint16 ReadU16(const uint8* In)
+    {
+        return static_cast<uint16>((In[0] << 8) | In[1]);
+    }
+
+    FORCEINLINE uint32 ReadU32(const uint8* In)
+    {
+        return (static_cast<uint32>(In[0]) << 24) | (static_cast<uint32>(In[1]) << 16) |
+            (static_cast<uint32>(In[2]) << 8) | static_cast<uint32>(In[3]);
+    }
+
+    FORCEINLINE uint64 ReadU64(const uint8* In)
+    {
+        uint64 Value = 0;
+        for (int32 i = 0; i < 8; ++i)
+        {
+            Value = (Value << 8) | In[i];
+        }
+        return Value;
+    }
+
+    /**
+     * Pack an "HH:MM:SS:FF" (or ';' separated) label into a frame number
+     * The radix is raised above the nominal rate when the frames field needs it, so any
+     * well-formed label round-trips exactly.
+     */
+    bool PackTimecodeLabel(const FString& Label, int32 NominalFps, uint32& OutFrameNumber, uint8& OutRadix, bool& bOutDropFrame)
+    {
+        // Shared single-pass parser; the wire form only carries canonical fields
+        const FTimecodeParseResult Parsed = FTimecodeValue::Parse(FStringView(Label));
+        if (!Parsed.IsValid() || !Parsed.bCanonicalFields)
+        {
+            return false;
+        }
+
+        bOutDropFrame = Parsed.bDropFrame;
+        const int32 Fields[4] = { Parsed.Fields.Hours, Parsed.Fields.Minutes, Parsed.Fields.Seconds, Parsed.Fields.Frames };
+
+        const int32 Radix = FMath::Clamp(FMath::Max(NominalFps, Fields[3] + 1), 1, 255);
+        OutRadix = static_cast<uint8>(Radix);
+        OutFrameNumber = ((static_cast<uint32>(Fields[0]) * 60 + Fields[1]) * 60 + Fields[2]) * Radix + Fields[3];
+        return true;
+    }
+}
+
+ETimecodeWireRate TimecodeWire::RateFromFrameRate(float FrameRate)
+{
+    for (const FWireRateEntry& Entry : WireRates)
+    {
+        if (FMath::IsNearlyEqual(static_cast<double>(FrameRate), Entry.FrameRate, 0.01))
+        {
+            return Entry.Rate;
+        }
+    }
+    return ETimecodeWireRate::Unknown;
+}
+
+double TimecodeWire::FrameRateFromRate(ETimecodeWireRate Rate)
+{
+    for (const FWireRateEntry& Entry : WireRates)
+    {
+        if (Entry.Rate == Rate)
+        {
+            return Entry.FrameRate;
+        }
+    }
+    return 0.0;
+}
+
+bool TimecodeWire::HasWireHeader(const uint8* Data, int32 Num)
+{
+    return Data != nullptr && Num >= 2 && Data[0] == MagicHi && Data[1] == MagicLo;
+}
+
+bool FTimecodeMessageView::Decode(TArrayView<const uint8> InBuffer, FTimecodeMessageView& OutView)
+{
+    const uint8* In = InBuffer.GetData();
+    if (!TimecodeWire::HasWireHeader(In, InBuffer.Num()) ||
+        InBuffer.Num() < TimecodeWire::HeaderSize || In[2] != TimecodeWire::Version)
+    {
+        return false; // Legacy, truncated or unsupported version
+    }
+
+    const uint16 PayloadLength = ReadU16(In + 28);
+    if (TimecodeWire::HeaderSize + PayloadLength > InBuffer.Num())
+    {
+        return false; // Insufficient data
+    }
+
+    OutView.MessageType = static_cast<ETimecodeMessageType>(In[3]);
+    OutView.Rate = static_cast<ETimecodeWireRate>(In[4]);
+    OutView.NominalFps = FMath::Max<uint8>(In[5], 1);
+    OutView.Flags = In[6];
+    OutView.FrameNumber = ReadU32(In + 8);
+    OutView.SenderID = ReadU32(In + 12);
+
+    const uint64 TimestampBits = ReadU64(In + 16);
+    FMemory::Memcpy(&OutView.Timestamp, &TimestampBits, sizeof(double));
+    OutView.Sequence = ReadU32(In + 24);
+
+    OutView.PayloadLength = PayloadLength;
+    OutView.Payload = PayloadLength > 0 ? In + TimecodeWire::HeaderSize : nullptr;
+
+    return true;
+}
+
+int32 FTimecodeMessageView::Encode(TArrayView<uint8> OutBuffer) const
+{
+    const int32 MessageSize = TimecodeWire::HeaderSize + PayloadLength;
+    if (PayloadLength > TimecodeWire::MaxPayloadSize || OutBuffer.Num() < MessageSize)
+    {
+        return 0;
+    }
+
+    uint8* Out = OutBuffer.GetData();
+    Out[0] = TimecodeWire::MagicHi;
+    Out[1] = TimecodeWire::MagicLo;
+    Out[2] = TimecodeWire::Version;
+    Out[3] = static_cast<uint8>(MessageType);
+    Out[4] = static_cast<uint8>(Rate);
+    Out[5] = NominalFps;
+    Out[6] = Flags;
+    Out[7] = 0;
+    WriteU32(Out + 8, FrameNumber);
+    WriteU32(Out + 12, SenderID);
+
+    uint64 TimestampBits;
+    FMemory::Memcpy(&TimestampBits, &Timestamp, sizeof(double));
+    WriteU64(Out + 16, TimestampBits);
+
+    WriteU32(Out + 24, Sequence);
+    WriteU16(Out + 28, PayloadLength);
+    if (PayloadLength > 0)
+    {
+        FMemory::Memcpy(Out + TimecodeWire::HeaderSize, Payload, PayloadLength);
+    }
+
+    return MessageSize;
+}
+
+bool FTimecodeMessageView::SetTimecode(const FString& Label, float InFrameRate)
+{
+    const int32 NominalRate = FMath::Clamp(FMath::RoundToInt(InFrameRate), 1, 255);
+    Rate = TimecodeWire::RateFromFrameRate(InFrameRate);
+    NominalFps = static_cast<uint8>(NominalRate);
+    Flags &= ~(TimecodeWire::FlagHasTimecode | TimecodeWire::FlagDropFrame);
+    FrameNumber = 0;
+
+    bool bDropFrame = false;
+    if (!PackTimecodeLabel(Label, NominalRate, FrameNumber, NominalFps, bDropFrame))
+    {
+        FrameNumber = 0;
+        return false;
+    }
+
+    Flags |= TimecodeWire::FlagHasTimecode;
+    if (bDropFrame)
+    {
+        Flags |= TimecodeWire::FlagDropFrame;
+    }
+    return true;
+}
+
+double FTimecodeMessageView::GetFrameRate() const
+{
+    const double ExactRate = TimecodeWire::FrameRateFromRate(Rate);
+    return ExactRate > 0.0 ? ExactRate : static_cast<double>(NominalFps);
+}
+
+double FTimecodeMessageView::GetTimecodeSeconds() const
+{
+    // Labels count frames in the nominal radix, but frames run at the real rate (29.97 NDF drifts from the wall clock)
+    const uint32 Radix = FMath::Max<uint32>(NominalFps, 1);
+    if (!IsDropFrame() || Radix % 30 != 0)
+    {
+        return static_cast<double>(FrameNumber) / GetFrameRate();
+    }
+
+    // Drop frame: labels skip Radix/15 frame numbers every minute except each tenth minute
+    const uint32 TotalMinutes = FrameNumber / (Radix * 60);
+    const uint32 DroppedFrames = (Radix / 15) * (TotalMinutes - TotalMinutes / 10);
+    return static_cast<double>(FrameNumber - DroppedFrames) / GetFrameRate();
+}
+
+FString FTimecodeMessageView::GetTimecodeString() const
+{
+    if (!HasTimecode())
+    {
+        return FString();
+    }
+
+    const uint32 Radix = FMath::Max<uint32>(NominalFps, 1);
+    uint32 Remaining = FrameNumber;
+    const uint32 Frames = Remaining % Radix;
+    Remaining /= Radix;
+    const uint32 Seconds = Remaining % 60;
+    Remaining /= 60;
+    const uint32 Minutes = Remaining % 60;
+    const uint32 Hours = Remaining / 60;
+
+    // Three frame digits above 100 fps, like FTimecodeValue::FormatTo
+    if (Radix > 100)
+    {
+        return FString::Printf(IsDropFrame() ? TEXT("%02u:%02u:%02u;%03u") : TEXT("%02u:%02u:%02u:%03u"),
+            Hours, Minutes, Seconds, Frames);
+    }
+    return FString::Printf(IsDropFrame() ? TEXT("%02u:%02u:%02u;%02u") : TEXT("%02u:%02u:%02u:%02u"),
+        Hours, Minutes, Seconds, Frames);
+}
+
+double FTimecodeMessageView::GetCorrection() const
+{
+    if (!HasCorrection() || Payload == nullptr || PayloadLength < TimecodeWire::CorrectionSize)
+    {
+        return 0.0;
+    }
+
+    const uint64 CorrectionBits = ReadU64(Payload);
+    double Correction;
+    FMemory::Memcpy(&Correction, &CorrectionBits, sizeof(double));
+    return Correction;
+}
+
+void FTimecodeMessageView::SetCorrection(double Correction, uint8* Storage)
+{
+    uint64 CorrectionBits;
+    FMemory::Memcpy(&CorrectionBits, &Correction, sizeof(double));
+    WriteU64(Storage, CorrectionBits);
+
+    Flags |= TimecodeWire::FlagCorrection;
+    Payload = Storage;
+    PayloadLength = TimecodeWire::CorrectionSize;
+}
+
+FString FTimecodeMessageView::GetPayloadString() const
+{
+    // The correction, election and transport fields are binary, not text
+    if (PayloadLength == 0 || Payload == nullptr ||
+        (Flags & (TimecodeWire::FlagCorrection | TimecodeWire::FlagElection | TimecodeWire::FlagTransport)) != 0)
+    {
+        return FString();
+    }
+
+    FUTF8ToTCHAR PayloadTChar(reinterpret_cast<const ANSICHAR*>(Payload), PayloadLength);
+    return FString(PayloadTChar.Length(), PayloadTChar.Get());
+}
+
+void FTimecodeMessageView::ToMessage(FTimecodeNetworkMessage& OutMessage) const
+{
+    OutMessage.MessageType = MessageType;
+    OutMessage.Timecode = GetTimecodeString();
+    OutMessage.Data = GetPayloadString();
+    OutMessage.Timestamp = Timestamp;
+    OutMessage.SenderNumericID = SenderID;
+    OutMessage.SenderID = FString::Printf(TEXT("%08X"), SenderID);
+    OutMessage.FrameRate = static_cast<float>(GetFrameRate());
+    OutMessage.Sequence = Sequence;
+}
+
+ETimecodeSequenceResult FTimecodeSequenceWindow::Check(uint32 Sequence, FTimecodeSenderStats& Stats)
+{
+    if (!bInitialized)
+    {
+        bInitialized = true;
+        HighestSequence = Sequence;
+        ReceivedMask = 1;
+        Stats.ReceivedCount++;
+        Stats.LastSequence = Sequence;
+        return ETimecodeSequenceResult::InOrder;
+    }
+
+    // Signed distance from the newest sequence (handles wrap-around)
+    const int32 Delta = static_cast<int32>(Sequence - HighestSequence);
+
+    if (Delta > ResyncThreshold || Delta < -ResyncThreshold)
+    {
+        // Sender restarted its counter - start tracking again
+        Reset();
+        return Check(Sequence, Stats);
+    }
+
+    if (Delta > 0)
+    {
+        // Senders skip 0 when the counter wraps, so it is not a missing packet
+        const int32 Skipped = Sequence < HighestSequence ? 1 : 0;
+        ReceivedMask = Delta < WindowSize ? (ReceivedMask << Delta) | 1 : 1;
+        HighestSequence = Sequence;
+        Stats.LostCount += Delta - 1 - Skipped;
+        Stats.ReceivedCount++;
+        Stats.LastSequence = Sequence;
+        return ETimecodeSequenceResult::InOrder;
+    }
+
+    const int32 Age = -Delta;
+    const uint64 Bit = Age < WindowSize ? (uint64(1) << Age) : 0;
+    if (Bit == 0 || (ReceivedMask & Bit) != 0)
+    {
+        Stats.DuplicateCount++;
+        return ETimecodeSequenceResult::Duplicate;
+    }
+
+    // Late arrival of a packet previously counted as lost
+    ReceivedMask |= Bit;
+    Stats.ReorderedCount++;
+    Stats.LostCount = FMath::Max(Stats.LostCount - 1, 0);
+    return ETimecodeSequenceResult::Reordered;
+}
+
+void FTimecodeSequenceWindow::Reset()
+{
+    HighestSequence = 0;
+    ReceivedMask = 0;
+    bInitialized = false;
+}
+
+void FTimecodeClockFilter::AddSample(double Offset, double Delay, double LocalTime)
+{
+    Samples[Next].Offset = Offset;
+    Samples[Next].Delay = Delay;
+    Samples[Next].LocalTime = LocalTime;
+    Next = (Next + 1) % WindowSize;
+    Count = FMath::Min(Count + 1, WindowSize);
+
+    // Window statistics and the minimum-delay sample
+    int32 Best = 0;
+    double DelaySum = 0.0;
+    Stats.MaxDelay = Samples[0].Delay;
+    for (int32 Index = 0; Index < Count; ++Index)
     {
-        Result.Add((NetworkTimestamp >> ((sizeof(double) - 1 - i) * 8)) & 0xFF);
+        const double SampleDelay = Samples[Index].Delay;
+        DelaySum += SampleDelay;
+        Stats.MaxDelay = FMath::Max(Stats.MaxDelay, SampleDelay);
+        if (SampleDelay < Samples[Best].Delay)
+        {
+            Best = Index;
+        }
     }
+    Stats.MinDelay = Samples[Best].Delay;
+    Stats.MeanDelay = DelaySum / Count;
+    Stats.SampleCount = Count;
 
-    // Serialize sender ID
-    FTCHARToUTF8 SenderIDUtf8(*SenderID);
-    uint16 SenderIDLength = static_cast<uint16>(SenderIDUtf8.Length());
-    Result.Add(SenderIDLength & 0xFF);
-    Result.Add((SenderIDLength >> 8) & 0xFF);
-    Result.Append((uint8*)SenderIDUtf8.Get(), SenderIDUtf8.Length());
-    // Add null terminator
-    Result.Add(0);
+    if (Mode == ETimecodeClockFilterMode::DelayWeighted)
+    {
+        // Floor keeps a near-zero loopback delay from taking all the weight
+        double WeightSum = 0.0;
+        double OffsetSum = 0.0;
+        double WeightedDelaySum = 0.0;
+        double LocalTimeSum = 0.0;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const double SampleDelay = FMath::Max(Samples[Index].Delay, 1e-6);
+            const double Weight = 1.0 / (SampleDelay * SampleDelay);
+            WeightSum += Weight;
+            OffsetSum += Weight * Samples[Index].Offset;
+            WeightedDelaySum += Weight * Samples[Index].Delay;
+            LocalTimeSum += Weight * Samples[Index].LocalTime;
+        }
+        Stats.SelectedOffset = OffsetSum / WeightSum;
+        Stats.SelectedDelay = WeightedDelaySum / WeightSum;
+        SelectedLocalTime = LocalTimeSum / WeightSum;
+    }
+    else
+    {
+        Stats.SelectedOffset = Samples[Best].Offset;
+        Stats.SelectedDelay = Samples[Best].Delay;
+        SelectedLocalTime = Samples[Best].LocalTime;
+    }
 
+    double SquaredSum = 0.0;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const double Difference = Samples[Index].Offset - Stats.SelectedOffset;
+        SquaredSum += Difference * Difference;
+    }
+    Stats.Jitter = FMath::Sqrt(SquaredSum / Count);
+}
+
+void FTimecodeHoldoverModel::AddSample(double PhaseError, double FrequencyChange)
+{
+    PhaseJitter += (FMath::Abs(PhaseError) - PhaseJitter) * Smoothing;
+    FrequencyError += (FMath::Abs(FrequencyChange) - FrequencyError) * Smoothing;
+}
+
+double FTimecodeHoldoverModel::GetUncertainty(double HoldoverSeconds) const
+{
+    const double Seconds = FMath::Max(HoldoverSeconds, 0.0);
+    return PhaseJitter + FMath::Max(FrequencyError, MinFrequencyError) * Seconds + 0.5 * FrequencyDrift * Seconds * Seconds;
+}
+
+double FTimecodeHoldoverModel::GetSlewFrequency(double Error, double MaxSlewRate)
+{
+    return FMath::Clamp(Error / SlewTimeConstant, -MaxSlewRate, MaxSlewRate);
+}
+
+void FTimecodeHoldoverModel::Reset()
+{
+    PhaseJitter = 0.0;
+    FrequencyError = 0.0;
+}
+
+void FTimecodeClockFilter::Reset()
+{
+    Count = 0;
+    Next = 0;
+    SelectedLocalTime = 0.0;
+    Stats = FTimecodeClockFilterStats();
+}
+
+bool FTimecodeSlaveRegistry::Register(uint32 SenderID, const FIPv4Endpoint& Endpoint, double Now)
+{
+    FEntry* Entry = Entries.Find(SenderID);
+    if (Entry && Entry->Endpoint == Endpoint)
+    {
+        Entry->LastSeenTime = Now;
+        return false;
+    }
+
+    // New slave or restarted on another port - resolve once here, not per send
+    FEntry& NewEntry = Entry ? *Entry : Entries.Add(SenderID);
+    NewEntry.Endpoint = Endpoint;
+    NewEntry.Addr = Endpoint.ToInternetAddr();
+    NewEntry.LastSeenTime = Now;
+    RebuildDestinations();
+    return true;
+}
+
+int32 FTimecodeSlaveRegistry::Prune(double Now, double Timeout)
+{
+    int32 Removed = 0;
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value().LastSeenTime > Timeout)
+        {
+            It.RemoveCurrent();
+            ++Removed;
+        }
+    }
+
+    if (Removed > 0)
+    {
+        RebuildDestinations();
+    }
+    return Removed;
+}
+
+TArray<FTimecodeSlaveInfo> FTimecodeSlaveRegistry::GetSlaveInfo(double Now) const
+{
+    TArray<FTimecodeSlaveInfo> Result;
+    Result.Reserve(Entries.Num());
+    for (const TPair<uint32, FEntry>& Pair : Entries)
+    {
+        FTimecodeSlaveInfo& Info = Result.AddDefaulted_GetRef();
+        Info.SenderID = FString::Printf(TEXT("%08X"), Pair.Key);
+        Info.Address = Pair.Value.Endpoint.ToString();
+        Info.SecondsSinceLastSeen = static_cast<float>(Now - Pair.Value.LastSeenTime);
+    }
     return Result;
 }
 
+void FTimecodeSlaveRegistry::Reset()
+{
+    Entries.Empty();
+    Destinations.Empty();
+}
+
+void FTimecodeSlaveRegistry::RebuildDestinations()
+{
+    Destinations.Reset(Entries.Num());
+    for (const TPair<uint32, FEntry>& Pair : Entries)
+    {
+        if (Pair.Value.Addr.IsValid())
+        {
+            Destinations.Add(Pair.Value.Addr.Get());
+        }
+    }
+}
+
+int32 FTimecodeElectionInfo::Encode(uint8* Out) const
+{
+    Out[0] = Priority;
+    Out[1] = ClockQuality;
+    Out[2] = bIsMaster ? 1 : 0;
+    WriteU32(Out + 3, UptimeSeconds);
+    return PayloadSize;
+}
+
+bool FTimecodeElectionInfo::Decode(const FTimecodeMessageView& Message)
+{
+    if (Message.MessageType != ETimecodeMessageType::Heartbeat || (Message.Flags & TimecodeWire::FlagElection) == 0 ||
+        Message.Payload == nullptr || Message.PayloadLength < PayloadSize)
+    {
+        return false;
+    }
+
+    Priority = Message.Payload[0];
+    ClockQuality = Message.Payload[1];
+    bIsMaster = (Message.Payload[2] & 1) != 0;
+    UptimeSeconds = ReadU32(Message.Payload + 3);
+    return true;
+}
+
+int32 FTimecodeTransportInfo::Encode(uint8* Out) const
+{
+    uint64 SecondsBits;
+    uint64 RateBits;
+    uint64 PreviousBits;
+    FMemory::Memcpy(&SecondsBits, &TimecodeSeconds, sizeof(double));
+    FMemory::Memcpy(&RateBits, &PlaybackRate, sizeof(double));
+    FMemory::Memcpy(&PreviousBits, &PreviousSeconds, sizeof(double));
+
+    WriteU64(Out, SecondsBits);
+    WriteU64(Out + 8, RateBits);
+    WriteU64(Out + 16, PreviousBits);
+    WriteU32(Out + 24, Generation);
+    return PayloadSize;
+}
+
+bool FTimecodeTransportInfo::Decode(const FTimecodeMessageView& Message)
+{
+    if (Message.MessageType != ETimecodeMessageType::Command || (Message.Flags & TimecodeWire::FlagTransport) == 0 ||
+        Message.Payload == nullptr || Message.PayloadLength < PayloadSize)
+    {
+        return false;
+    }
+
+    const uint64 SecondsBits = ReadU64(Message.Payload);
+    const uint64 RateBits = ReadU64(Message.Payload + 8);
+    const uint64 PreviousBits = ReadU64(Message.Payload + 16);
+    FMemory::Memcpy(&TimecodeSeconds, &SecondsBits, sizeof(double));
+    FMemory::Memcpy(&PlaybackRate, &RateBits, sizeof(double));
+    FMemory::Memcpy(&PreviousSeconds, &PreviousBits, sizeof(double));
+    Generation = ReadU32(Message.Payload + 24);
+    return Generation != 0 && FMath::IsFinite(TimecodeSeconds) && FMath::IsFinite(PlaybackRate) && FMath::IsFinite(PreviousSeconds);
+}
+
+void FTimecodeMasterElection::Observe(uint32 SenderID, const FTimecodeElectionInfo& Info, double Now)
+{
+    FCandidate& Candidate = Candidates.FindOrAdd(SenderID);
+    Candidate.Info = Info;
+    Candidate.LastSeenTime = Now;
+}
+
+uint32 FTimecodeMasterElection::Elect(uint32 LocalID, const FTimecodeElectionInfo& LocalInfo, double Now, double Timeout)
+{
+    uint32 BestID = LocalID;
+    FTimecodeElectionInfo BestInfo = LocalInfo;
+    double BestUptime = LocalInfo.UptimeSeconds;
+
+    for (auto It = Candidates.CreateIterator(); It; ++It)
+    {
+        const double Age = Now - It.Value().LastSeenTime;
+        if (Age > Timeout)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        // Advertised uptime plus the time since that heartbeat
+        const double Uptime = It.Value().Info.UptimeSeconds + Age;
+        if (It.Key() != LocalID && IsBetter(It.Key(), It.Value().Info, Uptime, BestID, BestInfo, BestUptime))
+        {
+            BestID = It.Key();
+            BestInfo = It.Value().Info;
+            BestUptime = Uptime;
+        }
+    }
+
+    return BestID;
+}
+
+bool FTimecodeMasterElection::IsBetter(uint32 IdA, const FTimecodeElectionInfo& A, double UptimeA,
+    uint32 IdB, const FTimecodeElectionInfo& B, double UptimeB)
+{
+    if (A.Priority != B.Priority)
+    {
+        return A.Priority < B.Priority;
+    }
+    if (A.ClockQuality != B.ClockQuality)
+    {
+        return A.ClockQuality < B.ClockQuality;
+    }
+    if (A.bIsMaster != B.bIsMaster)
+    {
+        return A.bIsMaster;
+    }
+    if (FMath::Abs(UptimeA - UptimeB) > UptimeTolerance)
+    {
+        return UptimeA > UptimeB;
+    }
+    return IdA < IdB;
+}
+
+int32 FTimecodeDelayResponse::Encode(uint8* Out) const
+{
+    uint64 RequestBits;
+    uint64 ReceiveBits;
+    FMemory::Memcpy(&RequestBits, &RequestTime, sizeof(double));
+    FMemory::Memcpy(&ReceiveBits, &ReceiveTime, sizeof(double));
+
+    WriteU32(Out, RequesterID);
+    WriteU64(Out + 4, RequestBits);
+    WriteU64(Out + 12, ReceiveBits);
+    return PayloadSize;
+}
+
+bool FTimecodeDelayResponse::Decode(const FTimecodeMessageView& Message)
+{
+    if (Message.MessageType != ETimecodeMessageType::DelayResponse ||
+        Message.Payload == nullptr || Message.PayloadLength < PayloadSize)
+    {
+        return false;
+    }
+
+    const uint64 RequestBits = ReadU64(Message.Payload + 4);
+    const uint64 ReceiveBits = ReadU64(Message.Payload + 12);
+    RequesterID = ReadU32(Message.Payload);
+    FMemory::Memcpy(&RequestTime, &RequestBits, sizeof(double));
+    FMemory::Memcpy(&ReceiveTime, &ReceiveBits, sizeof(double));
+    return true;
+}
+
+uint32 FTimecodeNetworkMessage::MakeSenderNumericID(const FString& InSenderID)
+{
+    // Never return 0 so that "unset" stays distinguishable
+    const uint32 Hash = FCrc::StrCrc32(*InSenderID);
+    return Hash != 0 ? Hash : 1;
+}
+
+TArray<uint8> FTimecodeNetworkMessage::Serialize() const
+{
+    uint8 Buffer[TimecodeWire::MaxMessageSize];
+    const int32 MessageSize = Serialize(MakeArrayView(Buffer));
+    return TArray<uint8>(Buffer, MessageSize);
+}
+
+int32 FTimecodeNetworkMessage::Serialize(TArrayView<uint8> OutBuffer) const
+{
+    // Short payloads convert in the inline buffer of the converter
+    FTCHARToUTF8 DataUtf8(*Data);
+
+    FTimecodeMessageView View;
+    View.MessageType = MessageType;
+    View.SetTimecode(Timecode, FrameRate);
+    View.SenderID = SenderNumericID != 0 ? SenderNumericID : MakeSenderNumericID(SenderID);
+    View.Timestamp = Timestamp;
+    View.Sequence = Sequence;
+    View.PayloadLength = static_cast<uint16>(FMath::Min(DataUtf8.Length(), TimecodeWire::MaxPayloadSize));
+    View.Payload = reinterpret_cast<const uint8*>(DataUtf8.Get());
+
+    return View.Encode(OutBuffer);
+}
+
 bool FTimecodeNetworkMessage::Deserialize(const TArray<uint8>& InData)
+{
+    // Old string format has no magic - use the compat decoder
+    if (!TimecodeWire::HasWireHeader(InData.GetData(), InData.Num()))
+    {
+        return DeserializeLegacy(InData);
+    }
+
+    FTimecodeMessageView View;
+    if (!FTimecodeMessageView::Decode(InData, View))
+    {
+        return false;
+    }
+
+    View.ToMessage(*this);
+    return true;
+}
+
+bool FTimecodeNetworkMessage::DeserializeLegacy(const TArray<uint8>& InData)
 {
     // Minimum size check (type + 3 strings with lengths + timestamp)
     if (InData.Num() < 1 + 2 + 1 + 2 + 1 + sizeof(double) + 2 + 1)
@@ -125,6 +799,7 @@ bool FTimecodeNetworkMessage::Deserialize(const TArray<uint8>& InData)
     FMemory::Memcpy(SenderIDBuffer.GetData(), &InData[Offset], SenderIDLength);
     SenderIDBuffer[SenderIDLength] = 0; // Ensure null termination
     SenderID = FString(UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(SenderIDBuffer.GetData())));
+    SenderNumericID = MakeSenderNumericID(SenderID);
 
     return true;
 }
\ No newline at end of file
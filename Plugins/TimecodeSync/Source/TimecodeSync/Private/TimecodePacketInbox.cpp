@@ -0,0 +1,119 @@
+﻿#include "TimecodePacketInbox.h"
+
+FTimecodePacketInbox::FTimecodePacketInbox()
+    : Capacity(0)
+    , SlotSize(0)
+    , Mask(0)
+    , ProducePos(0)
+    , Enqueued(0)
+    , DroppedNewest(0)
+    , DroppedOldest(0)
+    , Oversized(0)
+    , ConsumePos(0)
+    , MaxDrained(0)
+    , DropPolicy(ETimecodeInboxDropPolicy::DropOldest)
+{
+}
+
+void FTimecodePacketInbox::Initialize(int32 InCapacity, int32 InSlotSize)
+{
+    Capacity = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2))));
+    Mask = static_cast<uint64>(Capacity - 1);
+    SlotSize = FMath::Max(InSlotSize, 1);
+
+    Slots = MakeUnique<FSlot[]>(Capacity);
+    Storage.SetNumUninitialized(Capacity * SlotSize);
+
+    Reset();
+}
+
+void FTimecodePacketInbox::Reset()
+{
+    for (int32 Index = 0; Index < Capacity; ++Index)
+    {
+        Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+        Slots[Index].Size = 0;
+    }
+
+    ProducePos = 0;
+    ConsumePos.store(0, std::memory_order_relaxed);
+    Enqueued.store(0, std::memory_order_relaxed);
+    DroppedNewest.store(0, std::memory_order_relaxed);
+    DroppedOldest.store(0, std::memory_order_relaxed);
+    Oversized.store(0, std::memory_order_relaxed);
+    MaxDrained.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+bool FTimecodePacketInbox::Enqueue(const uint8* Data, int32 Num, const FIPv4Endpoint& Source, double ArrivalTime)
+{
+    if (!Slots.IsValid() || Num <= 0)
+    {
+        return false;
+    }
+
+    if (Num > SlotSize)
+    {
+        Oversized.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    FSlot& Slot = Slots[ProducePos & Mask];
+    if (Slot.Sequence.load(std::memory_order_acquire) != ProducePos)
+    {
+        // Full - make room if the policy allows it
+        if (DropPolicy.load(std::memory_order_relaxed) == ETimecodeInboxDropPolicy::DropOldest && DiscardOldest())
+        {
+            DroppedOldest.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (Slot.Sequence.load(std::memory_order_acquire) != ProducePos)
+        {
+            DroppedNewest.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    FMemory::Memcpy(Storage.GetData() + (ProducePos & Mask) * SlotSize, Data, Num);
+    Slot.Size = Num;
+    Slot.Source = Source;
+    Slot.ArrivalTime = ArrivalTime;
+    Slot.Sequence.store(ProducePos + 1, std::memory_order_release);
+    ++ProducePos;
+
+    Enqueued.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool FTimecodePacketInbox::DiscardOldest()
+{
+    uint64 Pos = ConsumePos.load(std::memory_order_relaxed);
+
+    // Only the slot we are about to reuse may be discarded; if the consumer has moved on it is
+    // still reading that slot and the incoming datagram is dropped instead
+    if (Pos + Capacity != ProducePos)
+    {
+        return false;
+    }
+
+    FSlot& Slot = Slots[Pos & Mask];
+    if (Slot.Sequence.load(std::memory_order_acquire) != Pos + 1 ||
+        !ConsumePos.compare_exchange_strong(Pos, Pos + 1, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    Slot.Sequence.store(Pos + Capacity, std::memory_order_release);
+    return true;
+}
+
+FTimecodeInboxStats FTimecodePacketInbox::GetStats() const
+{
+    FTimecodeInboxStats Stats;
+    Stats.EnqueuedCount = Enqueued.load(std::memory_order_relaxed);
+    Stats.DroppedNewestCount = DroppedNewest.load(std::memory_order_relaxed);
+    Stats.DroppedOldestCount = DroppedOldest.load(std::memory_order_relaxed);
+    Stats.OversizedCount = Oversized.load(std::memory_order_relaxed);
+    Stats.MaxDrainedPerTick = MaxDrained.load(std::memory_order_relaxed);
+    return Stats;
+}
@@ -8,11 +8,22 @@ UTimecodeSettings::UTimecodeSettings()
     DefaultUDPPort = 10000;
     MulticastGroupAddress = "239.0.0.1";
     BroadcastInterval = 0.033f; // Approximately 30Hz
+    InboxCapacity = 256;
+    InboxDropPolicy = ETimecodeInboxDropPolicy::DropOldest; // 최신 타임코드 우선
+    bUseNativeSocketBackend = true; // Linux 외 플랫폼에서는 무시
+    SocketBatchSize = 32;
+    bEnableUnicastFanOut = true;
+    SlaveTimeout = 6.0f;
 
     // Default role settings
     RoleMode = ETimecodeRoleMode::Automatic;
     bIsManualMaster = false;
     MasterIPAddress = "";
+    bIsRelayNode = false;
+    bEnableMasterElection = false;
+    MasterPriority = 128;
+    ClockQuality = 248;
+    ElectionTimeout = 6.0f;
 
     // Default nDisplay settings
     bEnableNDisplayIntegration = false;
@@ -22,6 +33,10 @@ UTimecodeSettings::UTimecodeSettings()
     bAutoStartTimecode = true;
     bEnablePacketLossCompensation = true;
     bEnableNetworkLatencyCompensation = true;
+    DelayRequestInterval = 1.0f;
+    ClockFilterMode = ETimecodeClockFilterMode::MinimumDelay;
+    HoldoverThreshold = 1.0f;
+    MaxSlewRatePPM = 500.0f;
     ConnectionCheckInterval = 1.0f;
     
 
@@ -0,0 +1,22 @@
+﻿#include "TimecodeValue.h"
+
+FString FTimecodeValue::ToString() const
+{
+    TCHAR Buffer[FormattedLength + 1];
+    return FString(FormatTo(Buffer), Buffer);
+}
+
+const TCHAR* FTimecodeValue::GetParseErrorText(ETimecodeParseError Error)
+{
+    switch (Error)
+    {
+    case ETimecodeParseError::None:                 return TEXT("valid");
+    case ETimecodeParseError::Empty:                return TEXT("empty");
+    case ETimecodeParseError::InvalidCharacter:     return TEXT("invalid character");
+    case ETimecodeParseError::MissingField:         return TEXT("missing field");
+    case ETimecodeParseError::FieldTooLong:         return TEXT("field has too many digits");
+    case ETimecodeParseError::TrailingCharacters:   return TEXT("trailing characters");
+    case ETimecodeParseError::OutOfRange:           return TEXT("minutes or seconds above 59");
+    default:                                        return TEXT("unknown");
+    }
+}
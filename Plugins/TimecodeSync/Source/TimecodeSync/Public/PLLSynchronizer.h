@@ -36,7 +36,7 @@ public:
     float ProcessTime(float LocalTime, float MasterTime, float DeltaTime);
 
     /**
-     * Update PLL state
+     * Update PLL state; without master samples the last frequency adjustment is held (holdover)
      * @param DeltaTime - Time since last update (seconds)
      */
     UFUNCTION(BlueprintCallable, Category = "Timecode|PLL")
@@ -71,6 +71,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Timecode|PLL")
     float GetFrequencyAdjustment() const { return FrequencyAdjustment; }
 
+    /**
+     * Whether no master sample has been processed for longer than HoldoverThreshold
+     */
+    UFUNCTION(BlueprintCallable, Category = "Timecode|PLL")
+    bool IsInHoldover() const { return bHasSample && TimeSinceLastSample > HoldoverThreshold; }
+
+    /**
+     * Get time since the last master sample
+     * @return Holdover duration (seconds, 0 when not in holdover)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Timecode|PLL")
+    float GetHoldoverDuration() const { return IsInHoldover() ? TimeSinceLastSample : 0.0f; }
+
     /**
      * Set PLL parameters
      * @param InBandwidth - PLL bandwidth (0.01-1.0)
@@ -89,6 +102,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timecode|PLL|Parameters")
     float FrequencyAdjustmentLimit;
 
+    // Time without master samples before the PLL reports holdover (seconds)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timecode|PLL|Parameters", meta = (ClampMin = "0.1"))
+    float HoldoverThreshold;
+
 private:
     // PLL state variables
     float CurrentError;
@@ -98,6 +115,8 @@ private:
     float PhaseAdjustment;
     double PhaseOffset;  // Track cumulative phase offset
     bool bIsLocked;
+    bool bHasSample;
+    float TimeSinceLastSample;
 
     // Internal parameters
     float Alpha;  // Proportional gain
@@ -5,6 +5,8 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
 #include "SMPTETimecodeConverter.generated.h"
 
 /**
@@ -64,11 +66,37 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Timecode|SMPTE")
     bool IsDropFrameTimecode(const FString& Timecode) const;
 
+    /**
+     * SecondsToTimecode calls answered from the cached label
+     * @return Number of cache hits since creation or the last reset
+     */
+    UFUNCTION(BlueprintCallable, Category = "Timecode|SMPTE")
+    int64 GetCacheHits() const { return static_cast<int64>(CacheHits.load(std::memory_order_relaxed)); }
+
+    /**
+     * SecondsToTimecode calls that had to format a new label
+     * @return Number of cache misses since creation or the last reset
+     */
+    UFUNCTION(BlueprintCallable, Category = "Timecode|SMPTE")
+    int64 GetCacheMisses() const { return static_cast<int64>(CacheMisses.load(std::memory_order_relaxed)); }
+
+    // Reset the hit/miss counters
+    UFUNCTION(BlueprintCallable, Category = "Timecode|SMPTE")
+    void ResetCacheStats();
+
 private:
-    // Helper functions
-    int64 CalculateDropFrameAdjustment(int64 TotalFrames, float FrameRate);
+    /**
+     * Last formatted label, keyed by integer frame number and rational rate
+     * Any time inside the same frame reuses the label; the lock makes the converter
+     * usable from worker threads.
+     */
+    FCriticalSection CacheLock;
+    int64 CachedFrameNumber;
+    int32 CachedRateNumerator;
+    int32 CachedRateDenominator;
+    bool bCachedDropFrame;
+    FString CachedTimecode;
 
-    // More accurate SMPTE drop frame constants
-    const double FRAMERATE_29_97 = 30.0 * 1000.0 / 1001.0;
-    const double FRAMERATE_59_94 = 60.0 * 1000.0 / 1001.0;
+    std::atomic<uint64> CacheHits;
+    std::atomic<uint64> CacheMisses;
 };
\ No newline at end of file
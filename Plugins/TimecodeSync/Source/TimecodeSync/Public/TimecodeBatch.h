@@ -0,0 +1,40 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "TimecodeValue.h"
+
+// One SMPTE label in four bytes (hours wrap at 100 to cover the vector range; FTimecodeValue::FormatTo prints them modulo 24; rates up to 255 fps)
+struct FTimecodePackedFields
+{
+    uint8 Hours = 0;
+    uint8 Minutes = 0;
+    uint8 Seconds = 0;
+    uint8 Frames = 0;
+};
+
+static_assert(sizeof(FTimecodePackedFields) == 4, "Batch conversion stores four packed labels per 16 bytes");
+
+/**
+ * Array conversions between frame numbers, seconds and timecode labels
+ *
+ * For tools that handle thousands of events at once (EDL import, cue lists, take logs). No strings
+ * are built; the frame -> label direction runs four frames per step on VectorRegister4Float
+ * (exact for frame numbers below MaxVectorFrame at 24-255 fps) and falls back to FTimecodeValue
+ * per frame otherwise. Results match FTimecodeValue::ToFields / FromFields / FromSeconds exactly.
+ * Each function converts Min(input, output) elements and returns that count.
+ *
+ * The rate comes from FTimecodeValue::FromFrameRate(FrameRate, bDropFrame).GetRate().
+ */
+namespace TimecodeBatch
+{
+    // Largest frame number handled by the vector path (float lanes stay exact below 2^24)
+    constexpr int64 MaxVectorFrame = 1 << 23;
+
+    TIMECODESYNC_API int32 FramesToFields(TArrayView<const int64> FrameNumbers, const FTimecodeRate& Rate, TArrayView<FTimecodePackedFields> OutFields);
+
+    TIMECODESYNC_API int32 SecondsToFields(TArrayView<const double> Seconds, const FTimecodeRate& Rate, TArrayView<FTimecodePackedFields> OutFields);
+
+    TIMECODESYNC_API int32 FieldsToFrames(TArrayView<const FTimecodePackedFields> Fields, const FTimecodeRate& Rate, TArrayView<int64> OutFrameNumbers);
+
+    TIMECODESYNC_API int32 FieldsToSeconds(TArrayView<const FTimecodePackedFields> Fields, const FTimecodeRate& Rate, TArrayView<double> OutSeconds);
+}
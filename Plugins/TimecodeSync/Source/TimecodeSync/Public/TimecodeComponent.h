@@ -5,6 +5,10 @@
 #include "TimecodeNetworkTypes.h"     // ETimecodeMode 정의가 포함된 헤더
 #include "PLLSynchronizer.h"
 #include "SMPTETimecodeConverter.h"
+#include "TimecodeMasterClock.h"
+#include "TimecodeValue.h"
+#include "TimecodeEventTimeline.h"
+#include "TimecodeEventScheduler.h"
 #include "TimecodeComponent.generated.h"
 
 // 전방 선언
@@ -18,6 +22,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimecodeChanged, const FString&,
 // Delegate declaration for timecode event trigger
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimecodeEventTriggered, const FString&, EventName, float, EventTime);
 
+// Delegate declaration for timecode event trigger with scheduled timecode and lateness
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimecodeEventFired, const FTimecodeEventFireInfo&, FireInfo);
+
 // Delegate declaration for network connection state change
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNetworkConnectionChanged, ENetworkConnectionState, NewState);
 
@@ -78,6 +85,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timecode")
     bool bAutoStart;
 
+    // 이벤트를 게임 스레드 틱과 별도로 스케줄러 스레드에서도 예정 시각에 디스패치 (DMX, OSC 등 비렌더 소비자용)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timecode")
+    bool bDispatchEventsOnWorkerThread;
+
     /** Network Settings */
 
     // UDP port setting (for receiving messages)
@@ -128,6 +139,20 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Timecode")
     bool bIsRunning;
 
+    // Playback rate (1 = real time, negative = reverse; slaves follow the master) (read-only)
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode|Transport")
+    float PlaybackRate;
+
+    // Loop range in seconds (master wraps from end to start, or start to end in reverse) (read-only)
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode|Transport")
+    bool bLoopEnabled;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode|Transport")
+    double LoopStartSeconds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode|Transport")
+    double LoopEndSeconds;
+
     /** Event Delegates */
 
     // Timecode change event
@@ -138,6 +163,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Timecode")
     FOnTimecodeEventTriggered OnTimecodeEventTriggered;
 
+    // Timecode event trigger with the scheduled timecode and how late the tick dispatched it
+    UPROPERTY(BlueprintAssignable, Category = "Timecode")
+    FOnTimecodeEventFired OnTimecodeEventFired;
+
     // Network connection state change event
     UPROPERTY(BlueprintAssignable, Category = "Network")
     FOnNetworkConnectionChanged OnNetworkConnectionChanged;
@@ -187,9 +216,41 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Timecode")
     FString GetCurrentTimecode() const;
 
-    // Get current time in seconds
+    // Frame number and rate behind the current timecode (master)
+    const FTimecodeValue& GetCurrentTimecodeValue() const { return CurrentTimecodeValue; }
+
+    // Get current time in seconds (sampled now, not at the last tick)
     UFUNCTION(BlueprintCallable, Category = "Timecode")
-    float GetCurrentTimeInSeconds() const;
+    double GetCurrentTimeInSeconds() const;
+
+    /** Transport Functions (master; slaves follow the master's transport commands) */
+
+    // Jump to a time in seconds, running or paused (scrub); events from there on are pending again
+    UFUNCTION(BlueprintCallable, Category = "Timecode|Transport")
+    bool SeekToSeconds(double Seconds);
+
+    // Jump to the start of a timecode label ("HH:MM:SS:FF", ';' for drop frame)
+    UFUNCTION(BlueprintCallable, Category = "Timecode|Transport")
+    bool SeekToTimecode(const FString& Timecode);
+
+    // Jump to the start of a frame counted from 00:00:00:00 at the component frame rate
+    UFUNCTION(BlueprintCallable, Category = "Timecode|Transport")
+    bool SeekToFrame(int64 FrameNumber);
+
+    // Set the playback rate (2 = double speed, 0 = hold, negative = reverse; events fire only going forward).
+    // Reverse playback without a loop pauses at 00:00:00:00.
+    UFUNCTION(BlueprintCallable, Category = "Timecode|Transport")
+    bool SetPlaybackRate(float NewRate);
+
+    UFUNCTION(BlueprintPure, Category = "Timecode|Transport")
+    float GetPlaybackRate() const;
+
+    // Loop between two times in seconds (end must be after start)
+    UFUNCTION(BlueprintCallable, Category = "Timecode|Transport")
+    bool SetLoopRange(double StartSeconds, double EndSeconds);
+
+    UFUNCTION(BlueprintCallable, Category = "Timecode|Transport")
+    void ClearLoopRange();
 
     /** Timecode Event Functions */
 
@@ -209,6 +270,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Timecode")
     void ResetEventTriggers();
 
+    // Start or stop dispatching events from the scheduler thread
+    UFUNCTION(BlueprintCallable, Category = "Timecode")
+    void SetDispatchEventsOnWorkerThread(bool bEnable);
+
+    // Scheduler thread event callback (C++ only, called off the game thread; bind while worker dispatch is off)
+    FOnTimecodeEventDispatched& OnTimecodeEventDispatched() { return EventScheduler.OnEventDispatched(); }
+
     /** Network Functions */
 
     // Get network connection state
@@ -315,14 +383,30 @@ public:
     void UpdateIntegratedTimecode(float DeltaTime);
 
 private:
-    // Elapsed time in seconds
-    float ElapsedTimeSeconds;
+    // Elapsed time in seconds at the last tick
+    double ElapsedTimeSeconds;
+
+    // Master timeline (cycle counter based, independent of DeltaTime)
+    FTimecodeMasterClock MasterClock;
+
+    // Frame behind CurrentTimecode (master); the string is rebuilt only when this changes
+    FTimecodeValue CurrentTimecodeValue;
+
+    // Publish a new frame: returns true and broadcasts OnTimecodeChanged if it differs from the current one
+    bool ApplyTimecodeValue(const FTimecodeValue& NewValue);
 
-    // Timecode event map (event name -> trigger time)
-    TMap<FString, float> TimecodeEvents;
+    // Registered timecode events, sorted by time; the cursor marks the events already triggered
+    FTimecodeEventTimeline EventTimeline;
 
-    // Track triggered events
-    TSet<FString> TriggeredEvents;
+    // Copy of the events dispatched from the scheduler thread (kept in step with EventTimeline)
+    FTimecodeEventScheduler EventScheduler;
+
+    // Frame rate last pushed to the scheduler (labels in its fire info)
+    float SchedulerFrameRate;
+    bool bSchedulerDropFrame;
+
+    // Push FrameRate and bUseDropFrameTimecode to the scheduler when either changed
+    void SyncEventSchedulerFrameRate();
 
     // Network synchronization timer
     float SyncTimer;
@@ -337,6 +421,27 @@ private:
     // Timecode event check function
     void CheckTimecodeEvents();
 
+    // Fire pending events up to a time (game thread delegates and network event messages);
+    // while a forward loop is on, events at or after the loop end are held back
+    void DispatchEventsUpTo(double Time);
+
+    // Whether the loop range applies at the current playback rate (forward only)
+    bool IsLoopingForward() const;
+
+    // Whether this node may move the timeline (master); logs the refused operation otherwise
+    bool CanControlTimeline(const TCHAR* Operation) const;
+
+    // Leave FromSeconds (firing events up to it when playing forward) and jump so the timeline was at
+    // TargetSeconds SinceTargetSeconds (timeline seconds) ago; sends one transport command.
+    // bForwardLoopWrap leaves the scheduler cursor alone (the scheduler thread wraps on its own)
+    void JumpTimeline(double FromSeconds, double TargetSeconds, double SinceTargetSeconds, bool bForwardLoopWrap = false);
+
+    // Wrap the master timeline at the loop range edges
+    void ApplyLoopRange();
+
+    // Pause reverse playback that reached 0 without a loop (the timeline never goes negative)
+    void HoldAtTimelineStart();
+
     // Network synchronization function
     void SyncOverNetwork();
 
@@ -358,6 +463,14 @@ private:
     UFUNCTION()
     void OnNetworkRoleModeChanged(ETimecodeRoleMode NewMode);
 
+    // Master election result callback
+    UFUNCTION()
+    void OnNetworkElectedRoleChanged(bool bNewIsMaster);
+
+    // Master transport command callback (slave)
+    UFUNCTION()
+    void OnNetworkTransportCommand(double PreviousSeconds, double TimecodeSeconds, float InPlaybackRate);
+
     // PLL Synchronizer sub-module
     UPROPERTY()
     UPLLSynchronizer* PLLSynchronizer;
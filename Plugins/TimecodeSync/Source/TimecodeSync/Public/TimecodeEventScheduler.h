@@ -0,0 +1,144 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "TimecodeEventTimeline.h"
+#include "TimecodeMasterClock.h"
+#include <atomic>
+#include "TimecodeEventScheduler.generated.h"
+
+class FRunnableThread;
+class FEvent;
+
+// When and how late a timecode event was dispatched
+USTRUCT(BlueprintType)
+struct FTimecodeEventFireInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode")
+    FString EventName;
+
+    // Time the event was registered for (seconds)
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode")
+    double ScheduledSeconds = 0.0;
+
+    // Timecode label of the scheduled time
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode")
+    FString ScheduledTimecode;
+
+    // Timeline time when the event was dispatched (seconds)
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode")
+    double FiredSeconds = 0.0;
+
+    // FiredSeconds - ScheduledSeconds
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode")
+    double LatenessSeconds = 0.0;
+
+    // Whether the event was dispatched from the scheduler thread rather than the game thread tick
+    UPROPERTY(BlueprintReadOnly, Category = "Timecode")
+    bool bFromWorkerThread = false;
+
+    static FTimecodeEventFireInfo Make(const FTimecodeTimelineEvent& Event, double InFiredSeconds, float FrameRate, bool bDropFrame, bool bInFromWorkerThread);
+};
+
+// Scheduler thread callback; runs on the scheduler thread, not the game thread
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTimecodeEventDispatched, const FTimecodeEventFireInfo& /*FireInfo*/);
+
+/**
+ * Dispatches timecode events from a dedicated thread at their scheduled time
+ *
+ * For consumers that do not render (DMX, OSC) and should not wait for the next game thread
+ * tick. The thread sleeps until shortly before the next pending event and yields through the
+ * last SpinWindow seconds, so lateness is bounded by the wake-up jitter instead of the frame
+ * time. Events only fire while the clock runs forward. The game thread owns the timeline clock and copies it in with SetClock whenever it moves
+ * (every tick on a slave); between copies the clock runs on the cycle counter.
+ *
+ * With a loop range the thread wraps on its own when the clock reaches the loop end: events at or
+ * after the end never fire inside the loop and the cursor returns to the loop start without
+ * waiting for the owner's tick. Clock copies taken before or after the owner wraps map onto the
+ * same loop pass, so the owner must not Seek the scheduler for a forward loop wrap.
+ */
+class TIMECODESYNC_API FTimecodeEventScheduler : public FRunnable
+{
+public:
+    // Final stretch before an event that is waited out by yielding instead of sleeping
+    static constexpr double SpinWindow = 0.002;
+
+    // Longest sleep, so clock changes and shutdown are noticed
+    static constexpr uint32 MaxWaitMs = 100;
+
+    FTimecodeEventScheduler();
+    virtual ~FTimecodeEventScheduler();
+
+    // Start the scheduler thread (bind OnEventDispatched first)
+    bool StartThread();
+
+    // Stop and join the scheduler thread
+    void Shutdown();
+
+    bool IsThreadRunning() const { return Thread != nullptr; }
+
+    // Timeline clock (copied; call again whenever the caller's clock starts, stops or jumps)
+    void SetClock(const FTimecodeMasterClock& InClock);
+
+    // Rate used for the timecode labels in the fire info
+    void SetFrameRate(float InFrameRate, bool bInDropFrame);
+
+    // Wrap from InLoopEnd back to InLoopStart during forward playback (ignored unless InLoopEnd > InLoopStart)
+    void SetLoopRange(double InLoopStart, double InLoopEnd);
+
+    void ClearLoopRange();
+
+    // Same semantics as FTimecodeEventTimeline
+    void AddEvent(const FString& Name, double Time);
+    void RemoveEvent(const FString& Name);
+    void Empty();
+    void Seek(double Time);
+    void ResetTriggers();
+    void Rewind(double Time);
+
+    /**
+     * Dispatch every event due at the current clock time
+     * Called by the scheduler thread; can be called directly when no thread is running.
+     * @return Number of events dispatched
+     */
+    int32 DispatchDue();
+
+    // Called on the scheduler thread; bind before StartThread, unbind after Shutdown
+    FOnTimecodeEventDispatched& OnEventDispatched() { return EventDispatched; }
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    // Wake the thread so it re-reads the next event time
+    void Wake();
+
+    // Whether the loop range applies to the current clock (lock held)
+    bool IsLooping() const;
+
+    // Timeline time with the thread's own loop wraps applied (lock held)
+    double GetLoopSeconds() const;
+
+    mutable FCriticalSection Lock;
+    FTimecodeEventTimeline Timeline;
+    FTimecodeMasterClock Clock;
+    float FrameRate;
+    bool bDropFrame;
+
+    bool bLoopEnabled;
+    double LoopStart;
+    double LoopEnd;
+
+    // Whole loop lengths subtracted from the clock by wraps the owner has not made yet
+    double LoopShift;
+
+    FOnTimecodeEventDispatched EventDispatched;
+
+    FRunnableThread* Thread;
+    FEvent* WakeEvent;
+    std::atomic<bool> bStopping;
+};
@@ -0,0 +1,139 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+// One registered cue
+struct FTimecodeTimelineEvent
+{
+    double Time = 0.0;
+    FString Name;
+};
+
+/**
+ * Time-sorted cue list with a playback cursor
+ *
+ * Events before the cursor have fired (or were skipped by a seek). Advancing only looks at the
+ * events between the cursor and the new time, so a tick where nothing fires costs one compare
+ * regardless of the cue count, and a seek is a binary search. Events with the same time fire in
+ * registration order.
+ */
+class TIMECODESYNC_API FTimecodeEventTimeline
+{
+public:
+    FTimecodeEventTimeline();
+
+    /**
+     * Register an event, replacing any event with the same name
+     * An event placed behind the cursor fires on the next Advance, like a cue registered late.
+     * @return true if an event with this name was replaced
+     */
+    bool Add(const FString& Name, double Time);
+
+    // Remove an event by name
+    bool Remove(const FString& Name);
+
+    void Empty();
+
+    // Place the cursor at Time: events before it count as passed, events at or after it are pending (O(log n))
+    void Seek(double Time);
+
+    // Make every event pending again
+    void ResetTriggers();
+
+    /**
+     * Move the cursor back over events at or after Time without firing them (reverse playback)
+     * Walks from the cursor, so the cost is the number of events passed.
+     */
+    void Rewind(double Time);
+
+    /**
+     * Fire every pending event at or before Time, in time order
+     * Callbacks may add or remove events; the cursor stays consistent.
+     * @return Number of events fired
+     */
+    template <typename CallbackType>
+    int32 Advance(double Time, CallbackType&& OnEvent)
+    {
+        return AdvanceTo(Time, true, OnEvent);
+    }
+
+    // Same as Advance, but events exactly at Time stay pending (loop end)
+    template <typename CallbackType>
+    int32 AdvanceBefore(double Time, CallbackType&& OnEvent)
+    {
+        return AdvanceTo(Time, false, OnEvent);
+    }
+
+    int32 Num() const { return Events.Num(); }
+
+    bool Contains(const FString& Name) const { return EventTimes.Contains(Name); }
+
+    // Events that have fired or were passed by a seek
+    int32 GetTriggeredCount() const { return Cursor - LateEvents.Num(); }
+
+    // Time of the next pending event in order (false if none)
+    bool GetNextEventTime(double& OutTime) const;
+
+private:
+    template <typename CallbackType>
+    int32 AdvanceTo(double Time, bool bInclusive, CallbackType& OnEvent)
+    {
+        const auto IsDue = [Time, bInclusive](double EventTime)
+        {
+            return bInclusive ? EventTime <= Time : EventTime < Time;
+        };
+
+        int32 Fired = 0;
+
+        // Events registered behind the cursor since the last advance
+        if (LateEvents.Num() > 0)
+        {
+            TArray<FString> Late = MoveTemp(LateEvents);
+            for (const FString& Name : Late)
+            {
+                const double* EventTime = EventTimes.Find(Name);
+                if (EventTime && IsDue(*EventTime))
+                {
+                    FTimecodeTimelineEvent Event;
+                    Event.Time = *EventTime;
+                    Event.Name = Name;
+                    OnEvent(Event);
+                    ++Fired;
+                }
+                else if (EventTime)
+                {
+                    LateEvents.Add(Name);
+                }
+            }
+        }
+
+        while (Cursor < Events.Num() && IsDue(Events[Cursor].Time))
+        {
+            // Copy: the callback may change the array
+            const FTimecodeTimelineEvent Event = Events[Cursor++];
+            OnEvent(Event);
+            ++Fired;
+        }
+        return Fired;
+    }
+
+    // First event at or after Time
+    int32 LowerBound(double Time) const;
+
+    // First event after Time
+    int32 UpperBound(double Time) const;
+
+    // Index of a registered event, or INDEX_NONE
+    int32 FindIndex(const FString& Name, double Time) const;
+
+    TArray<FTimecodeTimelineEvent> Events;
+
+    // Name -> time, to find an event without scanning
+    TMap<FString, double> EventTimes;
+
+    // Next event to fire
+    int32 Cursor;
+
+    // Pending events that sit behind the cursor
+    TArray<FString> LateEvents;
+};
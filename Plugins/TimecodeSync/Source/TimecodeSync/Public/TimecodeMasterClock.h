@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Monotonic master timeline sampled from the CPU cycle counter
+ *
+ * The elapsed time is not integrated from engine DeltaTime: it is computed on demand as
+ * BaseSeconds + (Cycles64() - AnchorCycles) * SecondsPerCycle64, so hitches do not leak into
+ * the timeline and a 10-hour day keeps sub-microsecond resolution. The anchor only moves when
+ * the clock is started, stopped, set or its rate changes, never per tick. The rate scales the
+ * cycle difference (2 = double speed, -1 = reverse).
+ */
+class TIMECODESYNC_API FTimecodeMasterClock
+{
+public:
+    FTimecodeMasterClock();
+
+    // Start counting from the current value (no-op when running)
+    void Start();
+
+    // Freeze the current value (no-op when stopped)
+    void Stop();
+
+    // Jump to a value, keeping the running state
+    void SetSeconds(double Seconds);
+
+    bool IsRunning() const { return bRunning; }
+
+    // Change the playback rate from the current value on
+    void SetRate(double InRate);
+
+    double GetRate() const { return Rate; }
+
+    // Current value, sampled now
+    double GetSeconds() const;
+
+    // Value at a given cycle counter reading (FPlatformTime::Cycles64 timebase)
+    double GetSecondsAt(uint64 Cycles) const;
+
+private:
+    double BaseSeconds;
+    uint64 AnchorCycles;
+    double Rate;
+    bool bRunning;
+};
@@ -8,12 +8,16 @@
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "IPAddress.h"
+#include "HAL/CriticalSection.h"
 #include "Serialization/ArrayReader.h"
 #include "TimecodeNetworkTypes.h"       // 공유 타입 정의를 포함
+#include "TimecodePacketInbox.h"
+#include <atomic>
 #include "TimecodeNetworkManager.generated.h"
 
 class FSocket;
 class FUdpSocketReceiver;
+class FTimecodeLinuxSocket;
 
 // Network connection state enum
 UENUM(BlueprintType)
@@ -33,6 +37,92 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNetworkStateChanged, ENetworkConn
 // Message received delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMessageReceived, const FTimecodeNetworkMessage&, Message);
 
+// Master election result delegate
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnElectedRoleChanged, bool, bIsMaster);
+
+// Transport command (seek / playback rate) from the master delegate
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnTransportCommandReceived, double, PreviousSeconds, double, TimecodeSeconds, float, PlaybackRate);
+
+// Resolved send address, reused until the address or send port changes
+struct FTimecodeCachedEndpoint
+{
+    TSharedPtr<FInternetAddr> Addr;
+    int32 Port = 0;
+
+    void Invalidate()
+    {
+        Addr.Reset();
+        Port = 0;
+    }
+};
+
+/**
+ * Single-writer sequence lock for a small trivially copyable value
+ * The writer never blocks; readers retry while a write is in progress.
+ */
+template <typename T>
+class TTimecodeSeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "TTimecodeSeqLock requires a trivially copyable type");
+    static constexpr int32 NumWords = (sizeof(T) + sizeof(uint64) - 1) / sizeof(uint64);
+
+public:
+    TTimecodeSeqLock()
+        : Version(0)
+    {
+        Store(T());
+    }
+
+    // Writer thread only
+    void Store(const T& Value)
+    {
+        uint64 Words[NumWords] = {};
+        FMemory::Memcpy(Words, &Value, sizeof(T));
+
+        const uint32 Current = Version.load(std::memory_order_relaxed);
+        Version.store(Current + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int32 Index = 0; Index < NumWords; ++Index)
+        {
+            Data[Index].store(Words[Index], std::memory_order_relaxed);
+        }
+        Version.store(Current + 2, std::memory_order_release);
+    }
+
+    // Any thread
+    T Load() const
+    {
+        uint64 Words[NumWords];
+        uint32 Before;
+        uint32 After;
+        do
+        {
+            Before = Version.load(std::memory_order_acquire);
+            for (int32 Index = 0; Index < NumWords; ++Index)
+            {
+                Words[Index] = Data[Index].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            After = Version.load(std::memory_order_relaxed);
+        } while ((Before & 1) != 0 || Before != After);
+
+        T Value;
+        FMemory::Memcpy(&Value, Words, sizeof(T));
+        return Value;
+    }
+
+private:
+    std::atomic<uint32> Version;
+    std::atomic<uint64> Data[NumWords];
+};
+
+// Receive-side sequence tracking for one remote sender
+struct FTimecodeSenderSequenceState
+{
+    FTimecodeSequenceWindow Window;
+    FTimecodeSenderStats Stats;
+};
+
 /**
  * Timecode network manager class
  */
@@ -65,6 +155,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Network")
     bool SendModeChangeCommand(ETimecodeMode NewMode);
 
+    // 탐색/재생 속도 명령 전송 (마스터) - 슬레이브는 재수렴 없이 서보 출력을 새 위치로 옮김
+    // PreviousSeconds: 떠나는 위치 (속도만 바꿀 때는 TimecodeSeconds와 같음)
+    // SecondsAgo: 타임라인이 TimecodeSeconds에 있었던 시점 (루프 되감기처럼 이미 지나간 위치를 보낼 때)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool SendTransportCommand(const FString& Timecode, double PreviousSeconds, double TimecodeSeconds, float PlaybackRate, double SecondsAgo = 0.0);
+
+    // 배치 전송 시작 - FlushBatch까지 타임코드/이벤트 메시지를 하나의 데이터그램으로 모음
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void BeginBatch();
+
+    // 모아둔 메시지를 전송하고 배치 모드 종료
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool FlushBatch();
+
     // Set target IP
     UFUNCTION(BlueprintCallable, Category = "Network")
     void SetTargetIP(const FString& IPAddress);
@@ -121,6 +225,36 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Network")
     bool IsMaster() const;
 
+    // 릴레이 노드: 상위 마스터에 슬레이브로 동기화하고, 등록된 하위 슬레이브에 체류 시간을 더해 재전송
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetRelayMode(bool bEnable);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool IsRelay() const;
+
+    // 자동 모드 마스터 선출: 하트비트로 우선순위/클럭 품질/가동 시간을 알리고 최적 노드가 마스터가 됨
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetMasterElection(bool bEnable);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool IsMasterElectionEnabled() const;
+
+    // 선출 우선순위 (낮을수록 우선) 및 클럭 품질 (낮을수록 좋음)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetElectionPriority(int32 Priority, int32 InClockQuality);
+
+    // 현재 선출된 마스터의 송신자 ID (선출 전이면 빈 문자열)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    FString GetElectedMasterID() const;
+
+    // 선출 결과로 이 노드의 역할이 바뀔 때 호출
+    UPROPERTY(BlueprintAssignable, Category = "Network")
+    FOnElectedRoleChanged OnElectedRoleChanged;
+
+    // 마스터의 탐색/재생 속도 명령 수신 (슬레이브, 서보는 이미 새 위치로 옮겨진 상태)
+    UPROPERTY(BlueprintAssignable, Category = "Network")
+    FOnTransportCommandReceived OnTransportCommandReceived;
+
     // Message received delegate
     UPROPERTY(BlueprintAssignable, Category = "Network")
     FOnMessageReceived OnMessageReceived;
@@ -137,6 +271,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Network")
     int32 GetTargetPort() const;
 
+    // 송신 타임코드의 프레임 레이트 설정 (와이어 포맷의 레이트 ID로 전송)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetFrameRate(float InFrameRate);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    float GetFrameRate() const;
+
     // 전용 마스터 기능 설정/조회
     UFUNCTION(BlueprintCallable, Category = "Network")
     void SetDedicatedMaster(bool bInIsDedicatedMaster);
@@ -161,8 +302,71 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Network")
     void GetPLLStatus(double& OutPhase, double& OutFrequency, double& OutOffset) const;
 
+    // 왕복 지연 클럭 필터 윈도우 통계 (마지막으로 게시된 서보 스냅샷 기준)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    FTimecodeClockFilterStats GetClockFilterStats() const;
+
+    // 왕복 지연 샘플 선택 방식 (최소 지연 / 지연 가중 평균)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetClockFilterMode(ETimecodeClockFilterMode NewMode);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    ETimecodeClockFilterMode GetClockFilterMode() const;
+
+    // 수신 스레드가 게시한 최신 서보 상태 (잠금 없이 어느 스레드에서나 읽기 가능)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    FTimecodeServoSnapshot GetServoSnapshot() const;
+
+    // 홀드오버 상태: 동기 패킷이 끊긴 시간과 누적 오차 추정치
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    FTimecodeHoldoverStatus GetHoldoverStatus() const;
+
+    // 홀드오버 진입 시간(초)과 복귀 시 최대 슬루 속도(ppm)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetHoldoverParameters(float Threshold, float MaxSlewPPM);
+
+    // 왕복 지연 측정(Delay_Req/Delay_Resp)으로 경로 지연 보상 (슬레이브)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetNetworkLatencyCompensation(bool bEnable);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool IsNetworkLatencyCompensationEnabled() const;
+
+    // 커널 수신 타임스탬프(SO_TIMESTAMPNS)로 도착 시각을 기록 중인지 여부 (Linux 전용)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool IsUsingKernelTimestamps() const;
+
+    // 송신자별 손실/순서 뒤바뀜/중복 패킷 통계
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    TArray<FTimecodeSenderStats> GetSenderStatistics() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void ResetSenderStatistics();
+
+    // 수신 인박스 (수신 스레드 -> 게임 스레드) 오버플로 정책 및 통계
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetInboxDropPolicy(ETimecodeInboxDropPolicy NewPolicy);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    ETimecodeInboxDropPolicy GetInboxDropPolicy() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    FTimecodeInboxStats GetInboxStats() const;
+
+    // 유니캐스트 팬아웃: 마스터가 Join으로 등록된 슬레이브 각각에 직접 전송 (멀티캐스트 미사용 시)
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    void SetUnicastFanOut(bool bEnable);
+
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    bool IsUnicastFanOutEnabled() const;
+
+    // 마스터에 등록된 슬레이브 목록
+    UFUNCTION(BlueprintCallable, Category = "Network")
+    TArray<FTimecodeSlaveInfo> GetRegisteredSlaves() const;
+
     /**
-     * 주기적 업데이트 (연결 상태 체크용)
+     * 주기적 업데이트 (수신 메시지 처리 및 연결 상태 체크용)
+     * 수신된 패킷은 이 함수에서 게임 스레드로 꺼내 처리되므로 매 프레임 호출해야 함
      * @param DeltaTime - 마지막 업데이트 이후 경과 시간
      */
     UFUNCTION(BlueprintCallable, Category = "Network")
@@ -178,12 +382,33 @@ private:
     // UDP receiver
     FUdpSocketReceiver* Receiver;
 
+    // Native socket backend: batched receive/send with kernel timestamps (Linux only, null when FUdpSocketReceiver is used)
+    FTimecodeLinuxSocket* NativeSocket;
+
     // Connection state
     ENetworkConnectionState ConnectionState;
 
     // Sender ID (unique identifier)
     FString InstanceID;
 
+    // Compact sender ID sent on the wire
+    uint32 InstanceNumericID;
+
+    // Frame rate of outgoing timecode
+    float TimecodeFrameRate;
+
+    // Last sequence number sent by this instance
+    uint32 LastSentSequence;
+
+    // Sequence tracking per remote sender (game thread only)
+    TMap<uint32, FTimecodeSenderSequenceState> SenderSequences;
+
+    // Next outgoing sequence number (never 0)
+    uint32 AllocateSequence();
+
+    // Track an incoming sequence number for its sender
+    ETimecodeSequenceResult CheckSequence(const FTimecodeMessageView& Message);
+
     /** Port used for receiving incoming messages from network */
     int32 ReceivePortNumber;
 
@@ -196,17 +421,44 @@ private:
     // Multicast group address
     FString MulticastGroupAddress;
 
-    // Master mode flag
-    bool bIsMasterMode;
+    // Master mode flag (also read by the receive thread)
+    std::atomic<bool> bIsMasterMode;
 
-    // UDP receive callback
+    // Relay mode flag (never master at the same time, also read by the receive thread)
+    std::atomic<bool> bIsRelayMode;
+
+    // UDP receive callback (receive thread - only queues the datagram)
     void OnUDPReceived(const FArrayReaderPtr& DataPtr, const FIPv4Endpoint& Endpoint);
 
+    // Validate a datagram, update the servo and queue it (receive thread, either receive path)
+    void HandleDatagram(const uint8* Data, int32 Num, double ArrivalTime, const FIPv4Endpoint& Source);
+
+    // Servo and delay measurement messages handled without waiting for the game thread
+    void HandleTimingMessage(const FTimecodeMessageView& Message, double ArrivalTime, const FIPv4Endpoint& Source);
+
+    // Bind the receive port on a native socket with kernel timestamps if enabled in settings
+    bool OpenNativeSocket();
+
+    // Start the native receive thread
+    bool StartNativeSocket();
+
+    // Stop the native receive thread and close its socket
+    void CloseNativeSocket();
+
+    // Datagrams handed from the receive thread to the game thread
+    FTimecodePacketInbox Inbox;
+
+    // Process queued datagrams on the game thread
+    void DrainInbox();
+
+    // Decode one datagram (v2 batch or legacy) and process each message
+    void ProcessDatagram(const uint8* Data, int32 Num, const FIPv4Endpoint& Source, double ArrivalTime);
+
     // Socket creation function
     bool CreateSocket();
 
-    // Message processing function
-    void ProcessMessage(const FTimecodeNetworkMessage& Message);
+    // Message processing function (decoded in place, no allocation unless delegates are bound)
+    void ProcessMessage(const FTimecodeMessageView& Message, const FIPv4Endpoint& Source, double ArrivalTime);
 
     // Connection state set function
     void SetConnectionState(ENetworkConnectionState NewState);
@@ -214,6 +466,9 @@ private:
     // Send heartbeat message
     void SendHeartbeat();
 
+    // 하트비트 전송 주기 타이머 (게임 스레드 전용, 인스턴스별)
+    float HeartbeatTimer;
+
     // Role mode setting
     ETimecodeRoleMode RoleMode;
 
@@ -235,12 +490,12 @@ private:
     // 전용 마스터 서버 관련 변수들
     bool bIsDedicatedMaster;   // 전용 마스터 서버 여부
 
-    // PLL 설정
-    bool bUsePLL;
-    float PLLBandwidth;     // PLL 반응성 (0.01-1.0)
-    float PLLDamping;       // PLL 안정성 (0.1-2.0)
+    // PLL 설정 (게임 스레드에서 설정, 수신 스레드에서 읽음)
+    std::atomic<bool> bUsePLL;
+    std::atomic<float> PLLBandwidth;     // PLL 반응성 (0.01-1.0)
+    std::atomic<float> PLLDamping;       // PLL 안정성 (0.1-2.0)
 
-    // PLL 상태 변수
+    // PLL 상태 변수 (수신 스레드 전용 - 외부에는 ServoSnapshot으로 게시)
     double PLLPhase;        // 위상 (현재 상태)
     double PLLFrequency;    // 주파수 (변화율)
     double PLLOffset;       // 오프셋 (보정값)
@@ -249,20 +504,164 @@ private:
     double LastMasterTimestamp;
     double LastLocalTimestamp;
 
+    // 서보 입력 필터 (수신 스레드 전용 - 현재 마스터의 늦은/중복 동기 패킷 제거)
+    FTimecodeSequenceWindow ServoSequenceWindow;
+    FTimecodeSenderStats ServoSequenceStats;
+    uint32 ServoSenderID;
+
+    // 게임 스레드에서 요청한 PLL 재초기화 (다음 샘플에서 수신 스레드가 수행)
+    std::atomic<bool> bServoResetRequested;
+
+    // 홀드오버 오차 모델과 복귀 슬루 상태 (수신 스레드 전용)
+    FTimecodeHoldoverModel HoldoverModel;
+    double PLLLastPhaseError;
+    bool bServoSlewing;
+
+    // 홀드오버 설정 (게임 스레드에서 설정, 수신 스레드에서 읽음)
+    std::atomic<float> HoldoverThreshold;
+    std::atomic<double> MaxSlewRate;     // 비율 (500ppm = 0.0005)
+
+    // 게임 스레드에 게시되는 서보 출력
+    TTimecodeSeqLock<FTimecodeServoSnapshot> ServoSnapshot;
+
+    // 수신 스레드에서 동기 샘플로 서보 갱신 (도착 시각 기준)
+    void UpdateServo(const FTimecodeMessageView& Message, double ArrivalTime);
+
+    // 수신 스레드에서 탐색/재생 속도 명령으로 게시된 타임코드 위치와 속도를 옮김
+    void ApplyTransport(const FTimecodeMessageView& Message, double ArrivalTime);
+
+    // 마지막 명령의 재생 속도와 세대 (수신 스레드 전용, 오래된 명령은 적용하지 않음)
+    double ServoPlaybackRate;
+    uint32 ServoTransportGeneration;
+
+    // 슬레이브: 델리게이트로 전달한 마지막 명령의 송신자와 세대 (게임 스레드 전용)
+    uint32 TransportSenderID;
+    uint32 TransportGeneration;
+
+    // 마스터: 마지막으로 보낸 명령 - 유실되어도 슬레이브가 따라오도록 같은 세대/타임스탬프로 주기적 재전송 (게임 스레드 전용)
+    static constexpr float TransportRefreshInterval = 1.0f;
+    FString LastTransportTimecode;
+    double LastTransportTimestamp;
+    FTimecodeTransportInfo LastTransport;
+    float TransportRefreshTimer;
+
+    // 마지막 명령을 새 시퀀스 번호로 전송 (배치 중이면 같은 데이터그램에)
+    bool SendLastTransport();
+
+    // 경로 지연 보상 (게임 스레드에서 설정, 수신 스레드에서 읽음)
+    std::atomic<bool> bLatencyCompensation;
+
+    // 슬레이브 Delay_Req 주기 (게임 스레드 전용)
+    float DelayRequestInterval;
+    float DelayRequestTimer;
+
+    // 응답을 기다리는 요청의 송신 시각 t1 (0 = 없음, 게임 스레드가 쓰고 수신 스레드가 소비)
+    std::atomic<double> PendingDelayRequestTime;
+
+    // 클럭 필터가 선택한 왕복 측정 결과 (수신 스레드 전용)
+    double ServoRoundTripDelay;
+    double ServoMeasuredOffset;
+
+    // 왕복 측정 샘플 윈도우 (수신 스레드 전용) 및 선택 방식 (게임 스레드에서 설정)
+    FTimecodeClockFilter ClockFilter;
+    std::atomic<ETimecodeClockFilterMode> ClockFilterMode;
+
+    // 마스터: 요청자별 마지막 응답 시각 (수신 스레드 전용, 슬레이브별 응답 빈도 제한)
+    // 제한 구간이 지난 항목은 주기적으로 제거 (떠난 슬레이브가 쌓이지 않도록)
+    TMap<uint32, double> DelayResponseTimes;
+    double DelayResponsePruneTime;
+
+    // 슬레이브: 왕복 지연 측정 요청 전송 (게임 스레드)
+    bool SendDelayRequest();
+
+    // 마스터: 요청 발신지로 t2/t3를 담아 즉시 응답 (수신 스레드)
+    void HandleDelayRequest(const FTimecodeMessageView& Message, double ArrivalTime, const FIPv4Endpoint& Source);
+
+    // 슬레이브: 응답으로 왕복 지연과 오프셋 계산 (수신 스레드)
+    void HandleDelayResponse(const FTimecodeMessageView& Message, double ArrivalTime);
+
     // 타임코드 보정 및 PLL 상태 업데이트
     void UpdatePLL(double MasterTime, double LocalTime);
     double GetPLLCorrectedTime(double LocalTime) const;
     void InitializePLL();
 
+    // 유니캐스트 팬아웃 (게임 스레드 전용)
+    bool bUnicastFanOut;
+    float SlaveTimeout;
+    float JoinTimer;
+
+    // 마스터: Join을 보낸 슬레이브 (게임 스레드에서 변경, 릴레이 재전송은 수신 스레드에서 읽음)
+    FTimecodeSlaveRegistry SlaveRegistry;
+
+    // 게임 스레드는 SlaveRegistry를 바꿀 때, 수신 스레드는 재전송할 때 잠금 (게임 스레드 읽기는 잠금 없음)
+    FCriticalSection SlaveRegistryLock;
+
+    // 슬레이브: 마스터에 등록/생존 알림 전송
+    bool SendJoin();
+
+    // 마스터 선출 (게임 스레드 전용)
+    bool bElectionEnabled;
+    float ElectionTimeout;
+    FTimecodeElectionInfo LocalElectionInfo;
+    FTimecodeMasterElection Election;
+    uint32 ElectedMasterID;
+    double CreationTime;           // 가동 시간 기준
+    double ElectionListenUntil;    // 초기화 후 이 시각까지는 다른 노드의 하트비트만 수집
+
+    // 선출이 이 노드의 역할을 결정하는지 여부 (자동 모드, 릴레이 아님)
+    bool IsElectionActive() const;
+
+    // 후보 중 최적 노드를 골라 역할 전환
+    void RunElection();
+
+    // 선출 결과 적용 (소켓 재초기화 없이 역할만 전환)
+    void ApplyElectedRole(bool bBecomeMaster);
+
+    // 마스터/릴레이가 내보내는 시각: 상위에 동기화된 적이 있으면 그 시간축을 이어서 사용
+    double GetServedTime(double LocalTime) const;
+
+    // 릴레이: 상위 마스터 메시지를 하위 슬레이브에 재전송 (수신 스레드, 동기 메시지는 경로 지연 + 체류 시간 보정 추가)
+    void ForwardDownstream(const FTimecodeMessageView& Message, double ArrivalTime);
+
+    // 릴레이: 재전송 전 송신자별 중복/늦은 패킷 제거 (수신 스레드 전용)
+    TMap<uint32, FTimecodeSenderSequenceState> RelaySequences;
+
     // 멀티캐스트 활성화 상태 추적
     bool bMulticastEnabled;
 
+    // 송신 대상 주소 캐시 (SetTargetIP/SetMasterIPAddress/SetTargetPort/JoinMulticastGroup에서 무효화)
+    FTimecodeCachedEndpoint TargetEndpoint;
+    FTimecodeCachedEndpoint MasterEndpoint;
+    FTimecodeCachedEndpoint MulticastEndpoint;
+
+    // 캐시된 주소 반환, 없거나 포트가 바뀐 경우에만 문자열 파싱 (잘못된 주소면 nullptr)
+    FInternetAddr* ResolveEndpoint(FTimecodeCachedEndpoint& Endpoint, const FString& Address);
+
+    void InvalidateEndpoints();
+
     // 특정 IP로 메시지 전송 헬퍼 함수
-    bool SendToSpecificIP(const TArray<uint8>& MessageData, const FString& IPAddress,
-        int32& BytesSent, const FString& TargetName);
+    bool SendToSpecificIP(TArrayView<const uint8> MessageData, FTimecodeCachedEndpoint& Endpoint,
+        const FString& IPAddress, int32& BytesSent, const TCHAR* TargetName);
 
     // 멀티캐스트 그룹으로 메시지 전송 헬퍼 함수
-    bool SendToMulticastGroup(const TArray<uint8>& MessageData, int32& BytesSent);
+    bool SendToMulticastGroup(TArrayView<const uint8> MessageData, int32& BytesSent);
+
+    // 활성 백엔드(네이티브 소켓 또는 FSocket)로 데이터그램 하나 전송
+    bool SendRaw(TArrayView<const uint8> Datagram, const FInternetAddr& Destination, int32& BytesSent);
+
+    // 같은 데이터그램을 여러 대상에 전송 (네이티브 백엔드는 sendmmsg 한 번에 최대 64개), 전송된 대상 수 반환
+    int32 SendToMany(TArrayView<const uint8> Datagram, TArrayView<const FInternetAddr* const> Destinations);
+
+    // 송신 우선순위(마스터 > 멀티캐스트 > 등록된 슬레이브 > 타겟)에 따라 데이터그램 하나 전송
+    bool SendDatagram(TArrayView<const uint8> Datagram);
+
+    // 배치 중이면 버퍼에 추가, 아니면 즉시 전송
+    bool QueueOrSend(TArrayView<const uint8> MessageData);
+
+    // 배치 전송 상태
+    bool bBatching;
+    int32 BatchSize;
+    uint8 BatchBuffer[TimecodeWire::MaxDatagramSize];
 
     // 연결 관리 변수
     float ConnectionCheckTimer;
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "TimecodeNetworkTypes.generated.h"
 
 // Timecode message type enum
@@ -11,7 +12,10 @@ enum class ETimecodeMessageType : uint8
     TimecodeSync,    // Timecode synchronization message
     RoleAssignment,  // Role assignment message
     Event,           // Event trigger message
-    Command          // Command message
+    Command,         // Command message
+    DelayRequest,    // Round-trip delay request (slave send time t1 in the timestamp)
+    DelayResponse,   // Round-trip delay response (master send time t3 in the timestamp, t1/t2 in the payload)
+    Join             // Slave registration for unicast fan-out (also serves as its liveness signal)
 };
 
 // Role determination mode enum
@@ -32,9 +36,652 @@ enum class ETimecodeMode : uint8
     Raw UMETA(DisplayName = "Raw Time (No Processing)")
 };
 
+// What the receive inbox does when it is full
+UENUM(BlueprintType)
+enum class ETimecodeInboxDropPolicy : uint8
+{
+    DropNewest UMETA(DisplayName = "Drop Incoming Packet"),
+    DropOldest UMETA(DisplayName = "Drop Oldest Queued Packet")
+};
+
+// How the clock filter turns its window of round-trip samples into one estimate
+UENUM(BlueprintType)
+enum class ETimecodeClockFilterMode : uint8
+{
+    MinimumDelay UMETA(DisplayName = "Lowest Round-Trip Delay"),
+    DelayWeighted UMETA(DisplayName = "Delay-Weighted Average")
+};
+
+// State of the slave clock relative to its master
+UENUM(BlueprintType)
+enum class ETimecodeSyncState : uint8
+{
+    Unsynchronized UMETA(DisplayName = "Not Synchronized"),
+    Locked UMETA(DisplayName = "Locked to Master"),
+    Holdover UMETA(DisplayName = "Holdover (Coasting on Learned Frequency)"),
+    Recovering UMETA(DisplayName = "Recovering (Slewing Back to Master)")
+};
+
+// Frame rate identifiers carried in the binary wire header
+enum class ETimecodeWireRate : uint8
+{
+    Unknown = 0,
+    Fps23_976,
+    Fps24,
+    Fps25,
+    Fps29_97,
+    Fps30,
+    Fps47_952,
+    Fps48,
+    Fps50,
+    Fps59_94,
+    Fps60,
+    Fps100,
+    Fps119_88,
+    Fps120,
+    Fps240
+};
+
+/**
+ * Binary wire format (v2) of FTimecodeNetworkMessage, all fields in network byte order
+ *
+ *   0  uint16  Magic ("TC")
+ *   2  uint8   Version
+ *   3  uint8   MessageType
+ *   4  uint8   RateId (ETimecodeWireRate)
+ *   5  uint8   NominalFps (radix of the packed frame number)
+ *   6  uint8   Flags
+ *   7  uint8   Reserved
+ *   8  uint32  FrameNumber (HH:MM:SS:FF label packed as ((H*60+M)*60+S)*NominalFps+F)
+ *  12  uint32  SenderId
+ *  16  uint64  Timestamp (IEEE 754 double bits)
+ *  24  uint32  Sequence (per sender, starts at 1; 0 = unsequenced)
+ *  28  uint16  PayloadLength
+ *  30  ...     Payload (UTF-8 event name / command, no terminator)
+ *
+ * A TimecodeSync message with FlagCorrection carries an 8-byte payload instead: the delay in
+ * seconds (double bits) accumulated between the master and this hop, added by relays.
+ * A Heartbeat with FlagElection carries FTimecodeElectionInfo as its payload.
+ * A Command with FlagTransport carries FTimecodeTransportInfo (seek target and playback rate).
+ *
+ * The first magic byte lies outside the legacy message type range, so packets in the
+ * old string format (type byte first) are still recognized and decoded.
+ *
+ * Messages are self-delimiting, so one datagram may carry several of them back to back
+ * (up to MaxDatagramSize bytes in total).
+ */
+namespace TimecodeWire
+{
+    constexpr uint8 MagicHi = 0x54;
+    constexpr uint8 MagicLo = 0x43;
+    constexpr uint8 Version = 2;
+    constexpr int32 HeaderSize = 30;
+    constexpr int32 MaxPayloadSize = 1024;
+    constexpr int32 MaxMessageSize = HeaderSize + MaxPayloadSize;
+
+    // Batched datagrams stay below a 1500-byte Ethernet MTU after IP/UDP headers
+    constexpr int32 MaxDatagramSize = 1400;
+
+    // Header flags
+    constexpr uint8 FlagDropFrame = 1 << 0;
+    constexpr uint8 FlagHasTimecode = 1 << 1;
+    constexpr uint8 FlagCorrection = 1 << 2;
+    constexpr uint8 FlagElection = 1 << 3;
+    constexpr uint8 FlagTransport = 1 << 4;
+
+    // Payload size of the correction field
+    constexpr int32 CorrectionSize = 8;
+
+    // Map a frame rate to its wire id (Unknown if it is not a standard rate)
+    TIMECODESYNC_API ETimecodeWireRate RateFromFrameRate(float FrameRate);
+
+    // Map a wire id back to its exact frame rate (0 for Unknown)
+    TIMECODESYNC_API double FrameRateFromRate(ETimecodeWireRate Rate);
+
+    // Check whether a buffer starts with the v2 magic
+    TIMECODESYNC_API bool HasWireHeader(const uint8* Data, int32 Num);
+}
+
+// Per-sender packet statistics derived from wire sequence numbers
+USTRUCT(BlueprintType)
+struct FTimecodeSenderStats
+{
+    GENERATED_BODY()
+
+    // Sender ID (hex form of the numeric wire id)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    FString SenderID;
+
+    // Packets accepted in order
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 ReceivedCount = 0;
+
+    // Sequence numbers skipped and not (yet) seen
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 LostCount = 0;
+
+    // Packets that arrived after a newer one from the same sender
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 ReorderedCount = 0;
+
+    // Packets already seen, or too old to tell
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 DuplicateCount = 0;
+
+    // Highest sequence number received
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int64 LastSequence = 0;
+};
+
+// Slave known to a unicast fan-out master
+USTRUCT(BlueprintType)
+struct FTimecodeSlaveInfo
+{
+    GENERATED_BODY()
+
+    // Sender ID (hex form of the numeric wire id)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    FString SenderID;
+
+    // Endpoint the slave joined from (IP:port)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    FString Address;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    float SecondsSinceLastSeen = 0.0f;
+};
+
+// Counters of the receive inbox between the socket thread and the game thread
+USTRUCT(BlueprintType)
+struct FTimecodeInboxStats
+{
+    GENERATED_BODY()
+
+    // Datagrams queued by the receive thread
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 EnqueuedCount = 0;
+
+    // Incoming datagrams discarded because the inbox was full
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 DroppedNewestCount = 0;
+
+    // Queued datagrams discarded to make room (DropOldest policy)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 DroppedOldestCount = 0;
+
+    // Datagrams larger than an inbox slot
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 OversizedCount = 0;
+
+    // Largest number of datagrams drained in one tick
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 MaxDrainedPerTick = 0;
+};
+
+// Window statistics of the round-trip clock filter
+USTRUCT(BlueprintType)
+struct FTimecodeClockFilterStats
+{
+    GENERATED_BODY()
+
+    // Samples currently in the window
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    int32 SampleCount = 0;
+
+    // Round-trip delay and offset handed to the servo
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double SelectedDelay = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double SelectedOffset = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double MinDelay = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double MaxDelay = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double MeanDelay = 0.0;
+
+    // RMS difference between the window offsets and the selected offset
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double Jitter = 0.0;
+};
+
+// Output of the network clock servo, published by the receive thread
+USTRUCT(BlueprintType)
+struct FTimecodeServoSnapshot
+{
+    GENERATED_BODY()
+
+    // Master timestamp of the last accepted sync sample
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double MasterTime = 0.0;
+
+    // Local arrival time of that sample (FPlatformTime::Seconds)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double LocalTime = 0.0;
+
+    // Timecode of that sample in seconds
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double TimecodeSeconds = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double Phase = 0.0;
+
+    // Master clock rate relative to the local clock
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double Frequency = 1.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double Offset = 0.0;
+
+    // Last measured round-trip delay to the master in seconds (0 until measured)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double RoundTripDelay = 0.0;
+
+    // Master minus local clock from the last round-trip measurement
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double MeasuredOffset = 0.0;
+
+    // Clock filter window the two values above were selected from
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    FTimecodeClockFilterStats FilterStats;
+
+    // Timecode seconds per master second (set by transport commands, negative in reverse)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double PlaybackRate = 1.0;
+
+    // Average phase error while locked (seconds), the starting point of the holdover error bound
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double PhaseJitter = 0.0;
+
+    // Average frequency change between samples while locked (fractional), how far the learned rate can be off
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double FrequencyError = 0.0;
+
+    // Offset still being slewed out after holdover (seconds, 0 when locked)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double SlewRemaining = 0.0;
+
+    bool IsValid() const { return LocalTime > 0.0; }
+
+    // Master time extrapolated to a local time
+    double GetMasterTime(double InLocalTime) const { return MasterTime + (InLocalTime - LocalTime) * Frequency; }
+
+    // Timecode seconds extrapolated to a local time
+    double GetTimecodeSeconds(double InLocalTime) const { return TimecodeSeconds + (InLocalTime - LocalTime) * Frequency * PlaybackRate; }
+
+    // Move the timecode so it reads InTimecodeSeconds at master time InMasterTime and runs at InPlaybackRate (clock servo untouched)
+    void Rebase(double InMasterTime, double InTimecodeSeconds, double InPlaybackRate)
+    {
+        TimecodeSeconds = InTimecodeSeconds - (InMasterTime - MasterTime) * InPlaybackRate;
+        PlaybackRate = InPlaybackRate;
+    }
+};
+
+// Holdover state of the network servo, derived from the age of the last accepted sync sample
+USTRUCT(BlueprintType)
+struct FTimecodeHoldoverStatus
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    ETimecodeSyncState State = ETimecodeSyncState::Unsynchronized;
+
+    // Time since the last sync sample while in holdover (seconds)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double HoldoverDuration = 0.0;
+
+    // Estimated bound of the accumulated time error (seconds)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double Uncertainty = 0.0;
+
+    // Frequency the clock is running at (learned master rate, plus slew while recovering)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double Frequency = 1.0;
+
+    // Offset still being slewed out (seconds)
+    UPROPERTY(BlueprintReadOnly, Category = "Network")
+    double SlewRemaining = 0.0;
+};
+
+// Classification of an incoming sequence number
+enum class ETimecodeSequenceResult : uint8
+{
+    InOrder,    // Newer than anything seen so far
+    Reordered,  // Older than the newest packet but not seen before
+    Duplicate   // Already seen, or older than the tracking window
+};
+
+/**
+ * Sliding window over one sender's sequence numbers
+ * Uses serial number arithmetic so the 32-bit counter may wrap.
+ */
+struct TIMECODESYNC_API FTimecodeSequenceWindow
+{
+    // Number of sequence numbers behind the newest one that are still tracked
+    static constexpr int32 WindowSize = 64;
+
+    // A jump further than this in either direction is treated as a sender restart
+    static constexpr int32 ResyncThreshold = 1024;
+
+    uint32 HighestSequence = 0;
+    uint64 ReceivedMask = 0;    // Bit N set = (HighestSequence - N) was received
+    bool bInitialized = false;
+
+    // Classify a sequence number and update the counters
+    ETimecodeSequenceResult Check(uint32 Sequence, FTimecodeSenderStats& Stats);
+
+    void Reset();
+};
+
+/**
+ * Error model of the servo clock for holdover
+ * While locked it averages the phase error and the sample-to-sample frequency change; in holdover the
+ * error bound grows as PhaseJitter + FrequencyError * t + FrequencyDrift * t^2 / 2. On recovery the
+ * published clock is slewed toward the master at a bounded rate instead of being stepped.
+ */
+struct TIMECODESYNC_API FTimecodeHoldoverModel
+{
+    // Floor of the learned frequency error (fractional) - a few samples never prove a perfect rate
+    static constexpr double MinFrequencyError = 1e-7;
+
+    // Assumed oscillator frequency wander in holdover (fractional per second)
+    static constexpr double FrequencyDrift = 1e-9;
+
+    // Weight of a new sample in the running averages
+    static constexpr double Smoothing = 0.1;
+
+    // Time constant of the slew toward the master, before the rate limit
+    static constexpr double SlewTimeConstant = 1.0;
+
+    // Slewing ends (the remaining offset is applied) below this error
+    static constexpr double SlewExitThreshold = 50e-6;
+
+    // Errors above this are stepped instead of slewed (the master timeline itself jumped)
+    static constexpr double SlewStepThreshold = 0.128;
+
+    double PhaseJitter = 0.0;
+    double FrequencyError = 0.0;
+
+    // Update the averages with a locked sample
+    void AddSample(double PhaseError, double FrequencyChange);
+
+    // Error bound after this many seconds without samples
+    double GetUncertainty(double HoldoverSeconds) const;
+
+    // Frequency offset that removes Error, limited to +/- MaxSlewRate
+    static double GetSlewFrequency(double Error, double MaxSlewRate);
+
+    void Reset();
+};
+
+/**
+ * Sliding window of round-trip (offset, delay) samples ahead of the servo
+ * Queueing only ever adds delay, so the sample with the lowest round-trip delay carries the
+ * least error; DelayWeighted mode blends the window with weights of 1 / delay^2 instead.
+ */
+struct TIMECODESYNC_API FTimecodeClockFilter
+{
+    static constexpr int32 WindowSize = 8;
+
+    struct FSample
+    {
+        double Offset = 0.0;
+        double Delay = 0.0;
+        double LocalTime = 0.0;
+    };
+
+    ETimecodeClockFilterMode Mode = ETimecodeClockFilterMode::MinimumDelay;
+
+    // Add a sample (oldest one falls out of the window) and update the estimate
+    void AddSample(double Offset, double Delay, double LocalTime);
+
+    bool HasEstimate() const { return Count > 0; }
+    double GetOffset() const { return Stats.SelectedOffset; }
+    double GetDelay() const { return Stats.SelectedDelay; }
+    const FTimecodeClockFilterStats& GetStats() const { return Stats; }
+
+    // Local time the selected offset was measured at (delay-weighted mean in DelayWeighted mode)
+    double GetLocalTime() const { return SelectedLocalTime; }
+
+    // Selected offset carried forward to LocalTime at a master/local frequency ratio
+    double GetOffsetAt(double LocalTime, double Frequency) const
+    {
+        return Stats.SelectedOffset + (Frequency - 1.0) * (LocalTime - SelectedLocalTime);
+    }
+
+    void Reset();
+
+private:
+    FSample Samples[WindowSize];
+    int32 Count = 0;
+    int32 Next = 0;
+    double SelectedLocalTime = 0.0;
+    FTimecodeClockFilterStats Stats;
+};
+
+/**
+ * Slaves a unicast fan-out master sends to, learned from their Join messages
+ * Each entry keeps a resolved address so a send pass is one SendToMany over GetDestinations()
+ * without parsing or allocating; entries that stop joining are removed by Prune.
+ */
+struct TIMECODESYNC_API FTimecodeSlaveRegistry
+{
+    struct FEntry
+    {
+        FIPv4Endpoint Endpoint;
+        TSharedPtr<FInternetAddr> Addr;
+        double LastSeenTime = 0.0;
+    };
+
+    /**
+     * Add a slave or refresh its liveness
+     * @return true if the slave is new or joined from a different endpoint
+     */
+    bool Register(uint32 SenderID, const FIPv4Endpoint& Endpoint, double Now);
+
+    // Remove slaves not seen for longer than Timeout, returns the number removed
+    int32 Prune(double Now, double Timeout);
+
+    // Resolved addresses of every registered slave (valid until the registry changes)
+    TArrayView<const FInternetAddr* const> GetDestinations() const { return Destinations; }
+
+    TArray<FTimecodeSlaveInfo> GetSlaveInfo(double Now) const;
+
+    int32 Num() const { return Entries.Num(); }
+    bool Contains(uint32 SenderID) const { return Entries.Contains(SenderID); }
+
+    void Reset();
+
+private:
+    void RebuildDestinations();
+
+    TMap<uint32, FEntry> Entries;
+    TArray<const FInternetAddr*> Destinations;
+};
+
+struct FTimecodeMessageView;
+
+/**
+ * Best-master election data advertised in heartbeats
+ * Ordering follows the PTP best master clock idea: lower priority value first, then the better
+ * clock reference, then the node that already is master (no churn), longer uptime, lower sender ID.
+ */
+struct TIMECODESYNC_API FTimecodeElectionInfo
+{
+    // Priority (u8) + ClockQuality (u8) + State (u8) + UptimeSeconds (u32)
+    static constexpr int32 PayloadSize = 7;
+
+    uint8 Priority = 128;       // Lower wins
+    uint8 ClockQuality = 248;   // Lower is a better reference (e.g. 6 = locked to genlock, 248 = free-running)
+    bool bIsMaster = false;
+    uint32 UptimeSeconds = 0;
+
+    // Write the payload, returns PayloadSize
+    int32 Encode(uint8* Out) const;
+
+    // Read the payload of a Heartbeat view with FlagElection
+    bool Decode(const FTimecodeMessageView& Message);
+};
+
+/**
+ * Seek target and playback rate sent by the master as one Command
+ * Slaves rebase their servo output on it instead of re-converging on the jumped sync labels.
+ * Every command gets a new generation; the master repeats the latest one (same generation and
+ * timestamp) so a lost command is recovered, and slaves apply each generation once, newest only.
+ */
+struct TIMECODESYNC_API FTimecodeTransportInfo
+{
+    // TimecodeSeconds (u64) + PlaybackRate (u64) + PreviousSeconds (u64), all double bits, + Generation (u32)
+    static constexpr int32 PayloadSize = 28;
+
+    double TimecodeSeconds = 0.0;   // Timeline position at the message timestamp
+    double PlaybackRate = 1.0;
+    double PreviousSeconds = 0.0;   // Position the timeline left from (events up to it fire first); equal for a rate change
+    uint32 Generation = 0;          // Per-master command counter (never 0 on the wire)
+
+    bool IsJump() const { return TimecodeSeconds != PreviousSeconds; }
+
+    // Whether this command was issued after the given generation (serial number order, 0 = none applied)
+    bool IsNewerThan(uint32 AppliedGeneration) const
+    {
+        return AppliedGeneration == 0 || static_cast<int32>(Generation - AppliedGeneration) > 0;
+    }
+
+    // Write the payload, returns PayloadSize
+    int32 Encode(uint8* Out) const;
+
+    // Read the payload of a Command view with FlagTransport
+    bool Decode(const FTimecodeMessageView& Message);
+};
+
+/**
+ * Candidates heard in election heartbeats and the deterministic choice among them
+ * Every node runs the same comparison over the same heartbeats, so all nodes agree on the winner
+ * once they have heard each other; a silent master drops out after the timeout.
+ */
+struct TIMECODESYNC_API FTimecodeMasterElection
+{
+    // Uptimes closer than this compare equal (heartbeats are sampled at different times)
+    static constexpr double UptimeTolerance = 5.0;
+
+    // Record a heartbeat from another node
+    void Observe(uint32 SenderID, const FTimecodeElectionInfo& Info, double Now);
+
+    // Drop candidates silent for longer than Timeout and return the sender ID of the best node (local included)
+    uint32 Elect(uint32 LocalID, const FTimecodeElectionInfo& LocalInfo, double Now, double Timeout);
+
+    // Whether A ranks above B (uptimes estimated at the same instant)
+    static bool IsBetter(uint32 IdA, const FTimecodeElectionInfo& A, double UptimeA,
+        uint32 IdB, const FTimecodeElectionInfo& B, double UptimeB);
+
+    int32 NumCandidates() const { return Candidates.Num(); }
+
+    void Reset() { Candidates.Empty(); }
+
+private:
+    struct FCandidate
+    {
+        FTimecodeElectionInfo Info;
+        double LastSeenTime = 0.0;
+    };
+
+    TMap<uint32, FCandidate> Candidates;
+};
+
+/**
+ * Payload of a DelayResponse message (NTP-style four timestamps)
+ * t1: slave send time of the request, t2: master receive time, t3: master send time
+ * (message timestamp), t4: slave receive time. Local times on each side are FPlatformTime::Seconds().
+ */
+struct TIMECODESYNC_API FTimecodeDelayResponse
+{
+    // RequesterID (u32) + RequestTime (u64) + ReceiveTime (u64)
+    static constexpr int32 PayloadSize = 20;
+
+    uint32 RequesterID = 0;     // Sender ID of the slave that asked
+    double RequestTime = 0.0;   // t1, echoed from the request
+    double ReceiveTime = 0.0;   // t2
+
+    // Write the payload, returns PayloadSize
+    int32 Encode(uint8* Out) const;
+
+    // Read the payload of a DelayResponse view
+    bool Decode(const FTimecodeMessageView& Message);
+
+    // Round trip minus the master residence time: (t4 - t1) - (t3 - t2)
+    double GetRoundTripDelay(double MasterSendTime, double LocalReceiveTime) const
+    {
+        return (LocalReceiveTime - RequestTime) - (MasterSendTime - ReceiveTime);
+    }
+
+    // Master minus local clock assuming a symmetric path: ((t2 - t1) + (t3 - t4)) / 2
+    double GetOffset(double MasterSendTime, double LocalReceiveTime) const
+    {
+        return ((ReceiveTime - RequestTime) + (MasterSendTime - LocalReceiveTime)) * 0.5;
+    }
+};
+
 // Delegate for role mode change event
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRoleModeChangedDelegate, ETimecodeRoleMode, NewMode);
 
+struct FTimecodeNetworkMessage;
+
+/**
+ * POD form of a v2 wire message
+ * Encodes into and decodes from caller-owned buffers without heap allocation.
+ * After Decode() the payload points into the source buffer, which must outlive the view.
+ */
+struct TIMECODESYNC_API FTimecodeMessageView
+{
+    ETimecodeMessageType MessageType = ETimecodeMessageType::Heartbeat;
+    ETimecodeWireRate Rate = ETimecodeWireRate::Unknown;
+    uint8 NominalFps = 30;
+    uint8 Flags = 0;
+    uint32 FrameNumber = 0;
+    uint32 SenderID = 0;
+    double Timestamp = 0.0;
+    uint32 Sequence = 0;
+    const uint8* Payload = nullptr;
+    uint16 PayloadLength = 0;
+
+    // Decode a v2 buffer (returns false for legacy or malformed data)
+    static bool Decode(TArrayView<const uint8> InBuffer, FTimecodeMessageView& OutView);
+
+    // Encode into a caller buffer, returns bytes written or 0 if it does not fit
+    int32 Encode(TArrayView<uint8> OutBuffer) const;
+
+    // Size of this message on the wire
+    int32 GetEncodedSize() const { return TimecodeWire::HeaderSize + PayloadLength; }
+
+    // Pack an "HH:MM:SS:FF" label (';' marks drop frame); clears the timecode if it does not parse
+    bool SetTimecode(const FString& Label, float InFrameRate);
+
+    bool HasTimecode() const { return (Flags & TimecodeWire::FlagHasTimecode) != 0; }
+    bool IsDropFrame() const { return (Flags & TimecodeWire::FlagDropFrame) != 0; }
+    bool HasCorrection() const { return (Flags & TimecodeWire::FlagCorrection) != 0; }
+
+    // Accumulated path delay and residence time added by relays (0 if none)
+    double GetCorrection() const;
+
+    // Point the payload at Storage (CorrectionSize bytes, must outlive the view) holding the correction
+    void SetCorrection(double Correction, uint8* Storage);
+
+    // Exact frame rate from the rate id, or the nominal rate for non-standard rates
+    double GetFrameRate() const;
+
+    // Timecode in seconds (drop-frame labels are converted through their frame count)
+    double GetTimecodeSeconds() const;
+
+    // Edge conversions (these allocate)
+    FString GetTimecodeString() const;
+    FString GetPayloadString() const;
+    void ToMessage(FTimecodeNetworkMessage& OutMessage) const;
+};
+
 // Timecode message structure for network transmission
 USTRUCT(BlueprintType)
 struct FTimecodeNetworkMessage
@@ -61,6 +708,16 @@ struct FTimecodeNetworkMessage
     UPROPERTY(BlueprintReadWrite, Category = "Network")
     FString SenderID;
 
+    // Frame rate of the timecode (sent as a rate id)
+    UPROPERTY(BlueprintReadWrite, Category = "Network")
+    float FrameRate;
+
+    // Compact sender id used on the wire (derived from SenderID when zero)
+    uint32 SenderNumericID;
+
+    // Per-sender sequence number (0 = unsequenced, e.g. legacy packets)
+    uint32 Sequence;
+
     // Default constructor
     FTimecodeNetworkMessage()
         : MessageType(ETimecodeMessageType::Heartbeat)
@@ -68,12 +725,25 @@ struct FTimecodeNetworkMessage
         , Data(TEXT(""))
         , Timestamp(0.0)
         , SenderID(TEXT(""))
+        , FrameRate(30.0f)
+        , SenderNumericID(0)
+        , Sequence(0)
     {
     }
 
-    // Serialize message to byte array
+    // Serialize message to byte array (wire v2)
     TArray<uint8> Serialize() const;
 
-    // Deserialize message from byte array
+    // Serialize into a caller buffer, returns bytes written or 0 if it does not fit
+    int32 Serialize(TArrayView<uint8> OutBuffer) const;
+
+    // Deserialize message from byte array (wire v2 or legacy string format)
     bool Deserialize(const TArray<uint8>& Data);
+
+    // Derive the compact numeric sender id from a sender id string
+    static uint32 MakeSenderNumericID(const FString& InSenderID);
+
+private:
+    // Decode the legacy length-prefixed string format
+    bool DeserializeLegacy(const TArray<uint8>& InData);
 };
\ No newline at end of file
@@ -0,0 +1,113 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "TimecodeNetworkTypes.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include <atomic>
+
+/**
+ * Bounded lock-free single-producer/single-consumer datagram ring
+ *
+ * The socket receive thread copies each datagram into a preallocated slot and the game
+ * thread drains the ring once per tick, so no allocation or task is created per packet.
+ * Each slot carries a sequence stamp: Pos + 1 when filled, Pos + Capacity when free again.
+ * Under the DropOldest policy the producer may claim the oldest filled slot through the
+ * same compare-exchange the consumer uses, so a slot is never read and written at once.
+ */
+class TIMECODESYNC_API FTimecodePacketInbox
+{
+public:
+    FTimecodePacketInbox();
+
+    // Allocate the slots (call while no receive thread is running)
+    void Initialize(int32 InCapacity, int32 InSlotSize);
+
+    bool IsInitialized() const { return Slots.IsValid(); }
+
+    // Discard queued datagrams and clear counters (call while no receive thread is running)
+    void Reset();
+
+    // Producer side: copy a datagram, its sender and arrival time into the next free slot
+    bool Enqueue(const uint8* Data, int32 Num, const FIPv4Endpoint& Source = FIPv4Endpoint::Any, double ArrivalTime = 0.0);
+
+    /**
+     * Consumer side: visit queued datagrams in arrival order
+     * The data pointer is only valid during the visitor call.
+     * @param Visitor - void(const uint8* Data, int32 Num, const FIPv4Endpoint& Source, double ArrivalTime)
+     * @return Number of datagrams visited
+     */
+    template <typename FuncType>
+    int32 Drain(FuncType&& Visitor)
+    {
+        if (!Slots.IsValid())
+        {
+            return 0;
+        }
+
+        // Bound the work per call so a flood cannot stall the game thread
+        int32 Count = 0;
+        while (Count < Capacity)
+        {
+            uint64 Pos = ConsumePos.load(std::memory_order_relaxed);
+            FSlot& Slot = Slots[Pos & Mask];
+            if (Slot.Sequence.load(std::memory_order_acquire) != Pos + 1)
+            {
+                break; // Empty
+            }
+
+            if (!ConsumePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_acq_rel))
+            {
+                continue; // Producer discarded this slot (DropOldest)
+            }
+
+            Visitor(Storage.GetData() + (Pos & Mask) * SlotSize, Slot.Size, Slot.Source, Slot.ArrivalTime);
+            Slot.Sequence.store(Pos + Capacity, std::memory_order_release);
+            ++Count;
+        }
+
+        if (Count > MaxDrained.load(std::memory_order_relaxed))
+        {
+            MaxDrained.store(Count, std::memory_order_relaxed);
+        }
+        return Count;
+    }
+
+    void SetDropPolicy(ETimecodeInboxDropPolicy InPolicy) { DropPolicy.store(InPolicy, std::memory_order_relaxed); }
+    ETimecodeInboxDropPolicy GetDropPolicy() const { return DropPolicy.load(std::memory_order_relaxed); }
+
+    int32 GetCapacity() const { return Capacity; }
+
+    FTimecodeInboxStats GetStats() const;
+
+private:
+    struct FSlot
+    {
+        std::atomic<uint64> Sequence;
+        int32 Size = 0;
+        FIPv4Endpoint Source;
+        double ArrivalTime = 0.0;
+    };
+
+    // Claim the oldest filled slot for the producer (DropOldest policy)
+    bool DiscardOldest();
+
+    TUniquePtr<FSlot[]> Slots;
+    TArray<uint8> Storage;
+    int32 Capacity;
+    int32 SlotSize;
+    uint64 Mask;
+
+    // Written by the producer only
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint64 ProducePos;
+    std::atomic<int32> Enqueued;
+    std::atomic<int32> DroppedNewest;
+    std::atomic<int32> DroppedOldest;
+    std::atomic<int32> Oversized;
+
+    // Advanced by the consumer, or by the producer when discarding the oldest slot
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> ConsumePos;
+    std::atomic<int32> MaxDrained;
+
+    std::atomic<ETimecodeInboxDropPolicy> DropPolicy;
+};
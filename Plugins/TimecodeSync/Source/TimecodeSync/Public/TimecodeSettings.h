@@ -40,6 +40,30 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Network", meta = (ClampMin = "0.001", ClampMax = "1.0"))
     float BroadcastInterval;
 
+    // Number of datagrams buffered between the receive thread and the game thread (rounded up to a power of two)
+    UPROPERTY(config, EditAnywhere, Category = "Network", meta = (ClampMin = "16", ClampMax = "4096"))
+    int32 InboxCapacity;
+
+    // Behaviour when the receive inbox is full
+    UPROPERTY(config, EditAnywhere, Category = "Network")
+    ETimecodeInboxDropPolicy InboxDropPolicy;
+
+    // Linux: native socket backend (recvmmsg/sendmmsg batching, kernel receive timestamps via SO_TIMESTAMPNS)
+    UPROPERTY(config, EditAnywhere, Category = "Network")
+    bool bUseNativeSocketBackend;
+
+    // Linux: maximum datagrams moved per recvmmsg/sendmmsg call
+    UPROPERTY(config, EditAnywhere, Category = "Network", meta = (EditCondition = "bUseNativeSocketBackend", ClampMin = "1", ClampMax = "64"))
+    int32 SocketBatchSize;
+
+    // Master sends to every slave that joined (one batched pass) when multicast is not used
+    UPROPERTY(config, EditAnywhere, Category = "Network")
+    bool bEnableUnicastFanOut;
+
+    // Slaves that have not re-joined for this long are dropped from the fan-out (seconds)
+    UPROPERTY(config, EditAnywhere, Category = "Network", meta = (EditCondition = "bEnableUnicastFanOut", ClampMin = "1.0", ClampMax = "60.0"))
+    float SlaveTimeout;
+
     /** Role Settings */
 
     // Role determination mode
@@ -54,6 +78,28 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Role", meta = (EditCondition = "RoleMode==ETimecodeRoleMode::Manual && !bIsManualMaster"))
     FString MasterIPAddress;
 
+    // Relay node: follows an upstream master like a slave and re-serves its time to slaves that join it
+    UPROPERTY(config, EditAnywhere, Category = "Role")
+    bool bIsRelayNode;
+
+    // Automatic mode: elect the best master from heartbeats and fail over when it goes silent
+    // (every node must hear the others' heartbeats, i.e. use a multicast group)
+    UPROPERTY(config, EditAnywhere, Category = "Role", meta = (EditCondition = "RoleMode==ETimecodeRoleMode::Automatic"))
+    bool bEnableMasterElection;
+
+    // Election priority, lower wins
+    UPROPERTY(config, EditAnywhere, Category = "Role", meta = (EditCondition = "bEnableMasterElection", ClampMin = "0", ClampMax = "255"))
+    int32 MasterPriority;
+
+    // Clock reference quality, lower is better (6 = locked to genlock / external reference, 248 = free-running)
+    UPROPERTY(config, EditAnywhere, Category = "Role", meta = (EditCondition = "bEnableMasterElection", ClampMin = "0", ClampMax = "255"))
+    int32 ClockQuality;
+
+    // A candidate silent for this long drops out and a standby takes over (seconds, heartbeats every 2 s).
+    // Election nodes stay connected while the master is silent, so this may exceed the 15 s master-lost timeout.
+    UPROPERTY(config, EditAnywhere, Category = "Role", meta = (EditCondition = "bEnableMasterElection", ClampMin = "2.0", ClampMax = "30.0"))
+    float ElectionTimeout;
+
     /** nDisplay Settings */
 
     // Enable nDisplay integration
@@ -78,6 +124,22 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Advanced")
     bool bEnableNetworkLatencyCompensation;
 
+    // Interval between round-trip delay requests sent by each slave (seconds)
+    UPROPERTY(config, EditAnywhere, Category = "Advanced", meta = (EditCondition = "bEnableNetworkLatencyCompensation", ClampMin = "0.1", ClampMax = "10.0"))
+    float DelayRequestInterval;
+
+    // How round-trip samples are selected before they reach the PLL
+    UPROPERTY(config, EditAnywhere, Category = "Advanced", meta = (EditCondition = "bEnableNetworkLatencyCompensation"))
+    ETimecodeClockFilterMode ClockFilterMode;
+
+    // Without sync packets for this long a slave enters holdover on its learned frequency (seconds)
+    UPROPERTY(config, EditAnywhere, Category = "Advanced", meta = (ClampMin = "0.1", ClampMax = "10.0"))
+    float HoldoverThreshold;
+
+    // Fastest rate at which the clock is pulled back to the master after holdover (parts per million)
+    UPROPERTY(config, EditAnywhere, Category = "Advanced", meta = (ClampMin = "1.0", ClampMax = "100000.0"))
+    float MaxSlewRatePPM;
+
     // 전용 타임코드 마스터 서버 설정
     UPROPERTY(config, EditAnywhere, Category = "Advanced", meta = (DisplayName = "Dedicated Master Server"))
     bool bIsDedicatedMaster;
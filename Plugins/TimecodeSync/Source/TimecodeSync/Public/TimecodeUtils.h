@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "TimecodeValue.h"
 #include "TimecodeUtils.generated.h"
 
 /**
@@ -33,6 +34,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Timecode")
     static float TimecodeToSeconds(const FString& Timecode, float FrameRate, bool bUseDropFrame = false);
 
+    /**
+     * Convert SMPTE timecode string to time in seconds, reporting why a label was rejected
+     * @param Timecode - Timecode string to convert (HH:MM:SS:FF or HH:MM:SS;FF)
+     * @param FrameRate - Frame rate
+     * @param bUseDropFrame - Whether to use drop frame timecode
+     * @param OutSeconds - Time in seconds (0 if the label is invalid)
+     * @return None if the label was parsed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Timecode")
+    static ETimecodeParseError ParseTimecode(const FString& Timecode, float FrameRate, bool bUseDropFrame, float& OutSeconds);
+
     /**
      * Convert current system time to timecode
      * @param FrameRate - Frame rate
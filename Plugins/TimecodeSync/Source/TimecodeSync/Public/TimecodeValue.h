@@ -0,0 +1,437 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "TimecodeValue.generated.h"
+
+// Why a timecode label was rejected
+UENUM(BlueprintType)
+enum class ETimecodeParseError : uint8
+{
+    None UMETA(DisplayName = "Valid"),
+    Empty UMETA(DisplayName = "Empty"),
+    InvalidCharacter UMETA(DisplayName = "Invalid Character"),
+    MissingField UMETA(DisplayName = "Missing Field"),
+    FieldTooLong UMETA(DisplayName = "Field Has Too Many Digits"),
+    TrailingCharacters UMETA(DisplayName = "Trailing Characters"),
+    OutOfRange UMETA(DisplayName = "Minutes or Seconds Above 59")
+};
+
+// Decomposed SMPTE timecode fields
+struct FTimecodeFields
+{
+    int32 Hours = 0;
+    int32 Minutes = 0;
+    int32 Seconds = 0;
+    int32 Frames = 0;
+};
+
+// Result of FTimecodeValue::Parse
+struct FTimecodeParseResult
+{
+    ETimecodeParseError Error = ETimecodeParseError::Empty;
+
+    // Offset of the first offending character in the input
+    int32 Position = 0;
+
+    FTimecodeFields Fields;
+
+    // A ';' separator was present
+    bool bDropFrame = false;
+
+    // Canonical HH:MM:SS:FF: two digits per field, or three frame digits (HH:MM:SS:FFF above 100 fps)
+    bool bCanonicalFields = false;
+
+    constexpr bool IsValid() const { return Error == ETimecodeParseError::None; }
+};
+
+/**
+ * Labelling constants of a frame rate
+ * Drop frame (SMPTE 12M) skips DropFramesPerMinute labels at the start of every minute except
+ * minutes divisible by ten; non-drop rates have DropFramesPerMinute == 0 and use the same math.
+ */
+struct FTimecodeRate
+{
+    int32 Numerator;
+    int32 Denominator;
+
+    // Integer frames per timecode second (30 for 30000/1001)
+    int32 NominalFps;
+
+    // Labels skipped per dropping minute (0 for non-drop)
+    int32 DropFramesPerMinute;
+
+    // Real frames in a dropping minute and in a ten minute block
+    int32 FramesPerMinute;
+    int32 FramesPer10Minutes;
+
+    constexpr FTimecodeRate(int32 InNumerator, int32 InDenominator, bool bDropFrame)
+        : Numerator(InNumerator)
+        , Denominator(InDenominator)
+        , NominalFps((InNumerator + InDenominator - 1) / InDenominator)
+        , DropFramesPerMinute(bDropFrame ? NominalFps / 15 : 0)
+        , FramesPerMinute(NominalFps * 60 - DropFramesPerMinute)
+        , FramesPer10Minutes(NominalFps * 600 - DropFramesPerMinute * 9)
+    {
+    }
+
+    constexpr bool IsDropFrame() const { return DropFramesPerMinute > 0; }
+
+    constexpr double GetFrameRate() const
+    {
+        return static_cast<double>(Numerator) / Denominator;
+    }
+};
+
+/**
+ * Timecode as an integer frame count at a rational frame rate
+ *
+ * Every conversion path (UTimecodeUtils, USMPTETimecodeConverter, UTimecodeComponent) derives
+ * hours/minutes/seconds/frames from this type, so there is one drop-frame implementation and no
+ * float rounding. Strings are only produced by ToString() at the edges.
+ * Drop frame follows SMPTE 12M: at 30000/1001 (60000/1001, 120000/1001) frame labels 0-1 (0-3, 0-7)
+ * are skipped at the start of every minute except minutes divisible by ten.
+ */
+struct FTimecodeValue
+{
+    int64 FrameNumber = 0;
+    int32 RateNumerator = 30;
+    int32 RateDenominator = 1;
+    bool bDropFrame = false;
+
+    constexpr FTimecodeValue() = default;
+
+    constexpr FTimecodeValue(int64 InFrameNumber, int32 InRateNumerator, int32 InRateDenominator, bool bInDropFrame)
+        : FrameNumber(InFrameNumber)
+        , RateNumerator(InRateNumerator > 0 ? InRateNumerator : 30)
+        , RateDenominator(InRateDenominator > 0 ? InRateDenominator : 1)
+        , bDropFrame(bInDropFrame && SupportsDropFrame(RateNumerator, RateDenominator))
+    {
+    }
+
+    // Drop frame exists only for the NTSC rates (x000/1001 with a nominal rate that is a multiple of 30)
+    static constexpr bool SupportsDropFrame(int32 Numerator, int32 Denominator)
+    {
+        return Denominator == 1001 && Numerator % 30000 == 0;
+    }
+
+    /**
+     * Rates with a compile-time descriptor; float frame rates snap to these first
+     * Pull-down rates (23.976, 47.952) are non-drop only.
+     */
+    static constexpr FTimecodeRate StandardRates[] =
+    {
+        { 24000, 1001, false },
+        { 24, 1, false },
+        { 25, 1, false },
+        { 30000, 1001, false },
+        { 30000, 1001, true },
+        { 30, 1, false },
+        { 48000, 1001, false },
+        { 48, 1, false },
+        { 50, 1, false },
+        { 60000, 1001, false },
+        { 60000, 1001, true },
+        { 60, 1, false },
+        { 120000, 1001, false },
+        { 120000, 1001, true },
+        { 120, 1, false },
+    };
+
+    // Labelling constants of this value's rate
+    constexpr FTimecodeRate GetRate() const
+    {
+        for (const FTimecodeRate& Rate : StandardRates)
+        {
+            if (Rate.Numerator == RateNumerator && Rate.Denominator == RateDenominator && Rate.IsDropFrame() == bDropFrame)
+            {
+                return Rate;
+            }
+        }
+        return FTimecodeRate(RateNumerator, RateDenominator, bDropFrame);
+    }
+
+    // Integer frames per timecode second (30 for 30000/1001)
+    constexpr int32 GetNominalFrameRate() const
+    {
+        return GetRate().NominalFps;
+    }
+
+    // Frame labels skipped per dropping minute (2 at 29.97, 4 at 59.94, 8 at 119.88)
+    constexpr int32 GetDropFramesPerMinute() const
+    {
+        return GetRate().DropFramesPerMinute;
+    }
+
+    constexpr double GetFrameRate() const
+    {
+        return static_cast<double>(RateNumerator) / RateDenominator;
+    }
+
+    /**
+     * Frame containing a point in time (negative times clamp to frame 0)
+     * A millionth of a frame is added before flooring so times computed in float land on their frame.
+     */
+    static constexpr FTimecodeValue FromSeconds(double Seconds, int32 Numerator, int32 Denominator, bool bInDropFrame)
+    {
+        const FTimecodeValue Rate(0, Numerator, Denominator, bInDropFrame);
+        const double Frames = Seconds * Rate.RateNumerator / Rate.RateDenominator + 1e-6;
+        return FTimecodeValue(Frames > 0.0 ? static_cast<int64>(Frames) : 0, Rate.RateNumerator, Rate.RateDenominator, Rate.bDropFrame);
+    }
+
+    // Same, from the float frame rates used by settings and Blueprint (29.97 -> 30000/1001)
+    static constexpr FTimecodeValue FromSeconds(double Seconds, float FrameRate, bool bInDropFrame)
+    {
+        const FTimecodeValue Rate = FromFrameRate(FrameRate, bInDropFrame);
+        return FromSeconds(Seconds, Rate.RateNumerator, Rate.RateDenominator, Rate.bDropFrame);
+    }
+
+    // Frame 0 at the rational rate closest to a float frame rate
+    static constexpr FTimecodeValue FromFrameRate(float FrameRate, bool bInDropFrame)
+    {
+        for (const FTimecodeRate& Rate : StandardRates)
+        {
+            const double Error = FrameRate - Rate.GetFrameRate();
+            if (Error < 0.005 && Error > -0.005)
+            {
+                return FTimecodeValue(0, Rate.Numerator, Rate.Denominator, bInDropFrame);
+            }
+        }
+
+        // Other NTSC rates are x000/1001; anything else is kept to a thousandth of a frame
+        const int32 Nominal = static_cast<int32>(FrameRate + 0.5f);
+        const double NtscRate = Nominal * 1000.0 / 1001.0;
+        const double NtscError = FrameRate > NtscRate ? FrameRate - NtscRate : NtscRate - FrameRate;
+        if (Nominal > 0 && Nominal != FrameRate && NtscError < 0.005)
+        {
+            return FTimecodeValue(0, Nominal * 1000, 1001, bInDropFrame);
+        }
+        if (Nominal > 0 && Nominal == FrameRate)
+        {
+            return FTimecodeValue(0, Nominal, 1, bInDropFrame);
+        }
+        return FTimecodeValue(0, FrameRate > 0.0f ? static_cast<int32>(FrameRate * 1000.0f + 0.5f) : 30000, 1000, bInDropFrame);
+    }
+
+    // Frame addressed by a timecode label
+    static constexpr FTimecodeValue FromFields(const FTimecodeFields& Fields, int32 Numerator, int32 Denominator, bool bInDropFrame)
+    {
+        FTimecodeValue Value(0, Numerator, Denominator, bInDropFrame);
+        const FTimecodeRate Rate = Value.GetRate();
+        const int64 TotalMinutes = static_cast<int64>(Fields.Hours) * 60 + Fields.Minutes;
+        const int64 Labels = (TotalMinutes * 60 + Fields.Seconds) * Rate.NominalFps + Fields.Frames;
+        Value.FrameNumber = Labels - Rate.DropFramesPerMinute * (TotalMinutes - TotalMinutes / 10);
+        return Value;
+    }
+
+    static constexpr FTimecodeValue FromFields(const FTimecodeFields& Fields, float FrameRate, bool bInDropFrame)
+    {
+        const FTimecodeValue Rate = FromFrameRate(FrameRate, bInDropFrame);
+        return FromFields(Fields, Rate.RateNumerator, Rate.RateDenominator, Rate.bDropFrame);
+    }
+
+    // Start time of the frame
+    constexpr double ToSeconds() const
+    {
+        return static_cast<double>(FrameNumber) * RateDenominator / RateNumerator;
+    }
+
+    // Timecode label of the frame
+    constexpr FTimecodeFields ToFields() const
+    {
+        const FTimecodeRate Rate = GetRate();
+        const int64 Nominal = Rate.NominalFps;
+        const int64 Drop = Rate.DropFramesPerMinute;
+        int64 Labels = FrameNumber > 0 ? FrameNumber : 0;
+
+        // Add back the labels skipped before this frame. Same path for non-drop (Drop == 0); the
+        // first minute of a block gives (Remainder - Drop) / FramesPerMinute == 0 by truncation.
+        const int64 TenMinuteBlocks = Labels / Rate.FramesPer10Minutes;
+        const int64 Remainder = Labels % Rate.FramesPer10Minutes;
+        Labels += Drop * (9 * TenMinuteBlocks + (Remainder - Drop) / Rate.FramesPerMinute);
+
+        FTimecodeFields Fields;
+        Fields.Frames = static_cast<int32>(Labels % Nominal);
+        Labels /= Nominal;
+        Fields.Seconds = static_cast<int32>(Labels % 60);
+        Labels /= 60;
+        Fields.Minutes = static_cast<int32>(Labels % 60);
+        Fields.Hours = static_cast<int32>(Labels / 60);
+        return Fields;
+    }
+
+    // Same frame at the same rate and labelling
+    constexpr bool operator==(const FTimecodeValue& Other) const
+    {
+        return FrameNumber == Other.FrameNumber && RateNumerator == Other.RateNumerator &&
+            RateDenominator == Other.RateDenominator && bDropFrame == Other.bDropFrame;
+    }
+
+    constexpr bool operator!=(const FTimecodeValue& Other) const
+    {
+        return !(*this == Other);
+    }
+
+    // Longest label written by FormatTo (HH:MM:SS:FFF)
+    static constexpr int32 FormattedLength = 12;
+
+    // Digits in the frames field: three when labels run past 99 (119.88, 120 fps), otherwise two
+    constexpr int32 GetFrameDigits() const
+    {
+        return GetNominalFrameRate() > 100 ? 3 : 2;
+    }
+
+    /**
+     * Write HH:MM:SS:FF (HH:MM:SS;FF for drop frame) without printf or allocation
+     * Hours wrap at 24 like a SMPTE 12M clock, so the length only depends on the rate (11, or 12 with three frame digits).
+     * @param Buffer - At least FormattedLength + 1 characters; the result is null-terminated
+     * @return Characters written
+     */
+    constexpr int32 FormatTo(TCHAR* Buffer) const
+    {
+        const FTimecodeFields Fields = ToFields();
+        WriteDigitPair(Buffer, Fields.Hours % 24);
+        Buffer[2] = TEXT(':');
+        WriteDigitPair(Buffer + 3, Fields.Minutes);
+        Buffer[5] = TEXT(':');
+        WriteDigitPair(Buffer + 6, Fields.Seconds);
+        Buffer[8] = bDropFrame ? TEXT(';') : TEXT(':');
+
+        int32 Length = 11;
+        if (GetFrameDigits() == 3)
+        {
+            Buffer[9] = static_cast<TCHAR>(TEXT('0') + Fields.Frames / 100);
+            WriteDigitPair(Buffer + 10, Fields.Frames % 100);
+            Length = 12;
+        }
+        else
+        {
+            WriteDigitPair(Buffer + 9, Fields.Frames);
+        }
+        Buffer[Length] = TEXT('\0');
+        return Length;
+    }
+
+    // HH:MM:SS:FF (HH:MM:SS;FF for drop frame, HH:MM:SS:FFF above 100 fps)
+    TIMECODESYNC_API FString ToString() const;
+
+    /**
+     * Validate and split a timecode label in one pass, in place and without allocation
+     * Accepts surrounding whitespace, one or two digits per field (up to three for frames) and
+     * ':' or ';' separators (any ';' marks the label as drop frame).
+     */
+    template <typename CharType>
+    static constexpr FTimecodeParseResult Parse(const CharType* Text, int32 Length)
+    {
+        FTimecodeParseResult Result;
+
+        int32 Pos = 0;
+        int32 End = Length;
+        while (Pos < End && IsBlank(Text[Pos]))
+        {
+            ++Pos;
+        }
+        while (End > Pos && IsBlank(Text[End - 1]))
+        {
+            --End;
+        }
+        if (Pos == End)
+        {
+            return Fail(Result, ETimecodeParseError::Empty, Pos);
+        }
+
+        int32 Values[4] = { 0, 0, 0, 0 };
+        int32 FieldStarts[4] = { 0, 0, 0, 0 };
+        Result.bCanonicalFields = true;
+        for (int32 Field = 0; Field < 4; ++Field)
+        {
+            if (Field > 0)
+            {
+                if (Pos == End)
+                {
+                    return Fail(Result, ETimecodeParseError::MissingField, Pos);
+                }
+                if (Text[Pos] == ';')
+                {
+                    Result.bDropFrame = true;
+                }
+                else if (Text[Pos] != ':')
+                {
+                    return Fail(Result, ETimecodeParseError::InvalidCharacter, Pos);
+                }
+                ++Pos;
+            }
+
+            const int32 FieldStart = Pos;
+            FieldStarts[Field] = FieldStart;
+            const int32 MaxDigits = Field == 3 ? 3 : 2;
+            while (Pos < End && Text[Pos] >= '0' && Text[Pos] <= '9')
+            {
+                if (Pos - FieldStart == MaxDigits)
+                {
+                    return Fail(Result, ETimecodeParseError::FieldTooLong, Pos);
+                }
+                Values[Field] = Values[Field] * 10 + static_cast<int32>(Text[Pos] - '0');
+                ++Pos;
+            }
+            if (Pos == FieldStart)
+            {
+                return Fail(Result, Pos == End ? ETimecodeParseError::MissingField : ETimecodeParseError::InvalidCharacter, Pos);
+            }
+            Result.bCanonicalFields = Result.bCanonicalFields && Pos - FieldStart >= 2;
+        }
+
+        if (Pos != End)
+        {
+            return Fail(Result, ETimecodeParseError::TrailingCharacters, Pos);
+        }
+
+        Result.Fields.Hours = Values[0];
+        Result.Fields.Minutes = Values[1];
+        Result.Fields.Seconds = Values[2];
+        Result.Fields.Frames = Values[3];
+        if (Values[1] > 59 || Values[2] > 59)
+        {
+            return Fail(Result, ETimecodeParseError::OutOfRange, FieldStarts[Values[1] > 59 ? 1 : 2]);
+        }
+
+        Result.Error = ETimecodeParseError::None;
+        return Result;
+    }
+
+    static FTimecodeParseResult Parse(FStringView Text)
+    {
+        return Parse(Text.GetData(), Text.Len());
+    }
+
+    static FTimecodeParseResult Parse(FUtf8StringView Text)
+    {
+        return Parse(Text.GetData(), Text.Len());
+    }
+
+    // Readable name of a parse error for logs
+    TIMECODESYNC_API static const TCHAR* GetParseErrorText(ETimecodeParseError Error);
+
+private:
+    template <typename CharType>
+    static constexpr bool IsBlank(CharType Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\n';
+    }
+
+    static constexpr FTimecodeParseResult Fail(FTimecodeParseResult Result, ETimecodeParseError Error, int32 Position)
+    {
+        Result.Error = Error;
+        Result.Position = Position;
+        return Result;
+    }
+
+    // "00" "01" ... "99": two digits per table lookup instead of a division per digit
+    static constexpr char DigitPairs[201] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+    static constexpr void WriteDigitPair(TCHAR* Out, int32 Value)
+    {
+        Out[0] = static_cast<TCHAR>(DigitPairs[Value * 2]);
+        Out[1] = static_cast<TCHAR>(DigitPairs[Value * 2 + 1]);
+    }
+};